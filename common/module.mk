@@ -28,6 +28,7 @@ MODULE_OBJS := \
 	quicktime.o \
 	random.o \
 	rational.o \
+	region.o \
 	rendermode.o \
 	str.o \
 	stream.o \
@@ -0,0 +1,275 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/region.h"
+
+namespace Common {
+
+namespace {
+
+/**
+ * Returns the index one past the last rectangle of the band starting at start.
+ */
+uint bandEnd(const Array<Rect> &rects, uint start) {
+	uint end = start + 1;
+	while (end < rects.size() && rects[end].top == rects[start].top)
+		++end;
+	return end;
+}
+
+/**
+ * Appends a band made up of the given horizontal spans to rects. If the band
+ * directly continues the previous band with exactly the same spans, the
+ * previous band is extended instead.
+ */
+void appendBand(Array<Rect> &rects, uint &lastBand, int16 top, int16 bottom, const Array<Rect> &spans) {
+	if (spans.empty() || top >= bottom)
+		return;
+
+	if (lastBand < rects.size() && rects[lastBand].bottom == top && rects.size() - lastBand == spans.size()) {
+		bool same = true;
+		for (uint i = 0; i < spans.size() && same; ++i) {
+			same = rects[lastBand + i].left == spans[i].left && rects[lastBand + i].right == spans[i].right;
+		}
+
+		if (same) {
+			for (uint i = lastBand; i < rects.size(); ++i)
+				rects[i].bottom = bottom;
+			return;
+		}
+	}
+
+	lastBand = rects.size();
+	for (uint i = 0; i < spans.size(); ++i)
+		rects.push_back(Rect(spans[i].left, top, spans[i].right, bottom));
+}
+
+/**
+ * Adds the spans of the band [start, end) to spans, merging any spans which
+ * overlap or touch. Both the band and spans must be sorted by left edge.
+ */
+void mergeSpans(Array<Rect> &spans, const Array<Rect> &rects, uint start, uint end) {
+	Array<Rect> merged;
+	uint i = 0;
+	uint j = start;
+
+	while (i < spans.size() || j < end) {
+		const Rect &next = (j == end || (i < spans.size() && spans[i].left <= rects[j].left)) ? spans[i++] : rects[j++];
+
+		if (!merged.empty() && merged.back().right >= next.left)
+			merged.back().right = MAX(merged.back().right, next.right);
+		else
+			merged.push_back(next);
+	}
+
+	spans = merged;
+}
+
+} // End of anonymous namespace
+
+void Region::addRect(const Rect &r) {
+	if (r.isEmpty())
+		return;
+
+	// Find the first band which ends below the top of the rectangle
+	uint pos = 0;
+	while (pos < _rects.size() && _rects[pos].bottom <= r.top)
+		++pos;
+
+	// No band overlaps the rectangle vertically, so it becomes a band of its own
+	if (pos == _rects.size() || _rects[pos].top >= r.bottom) {
+		insertBand(pos, r);
+		return;
+	}
+
+	// Nothing changes if a single rectangle already covers all of it
+	for (uint i = pos; i < _rects.size() && _rects[i].top < r.bottom; ++i) {
+		if (_rects[i].contains(r))
+			return;
+	}
+
+	Region other;
+	other._rects.push_back(r);
+	unite(other);
+}
+
+void Region::insertBand(uint pos, const Rect &r) {
+	// A neighbouring band is joined with the new one if it consists of a
+	// single rectangle with the same horizontal span which touches it
+	const bool joinAbove = pos > 0 && _rects[pos - 1].bottom == r.top &&
+		_rects[pos - 1].left == r.left && _rects[pos - 1].right == r.right &&
+		(pos == 1 || _rects[pos - 2].top != _rects[pos - 1].top);
+	const bool joinBelow = pos < _rects.size() && _rects[pos].top == r.bottom &&
+		_rects[pos].left == r.left && _rects[pos].right == r.right &&
+		(pos + 1 == _rects.size() || _rects[pos + 1].top != _rects[pos].top);
+
+	if (joinAbove && joinBelow) {
+		_rects[pos - 1].bottom = _rects[pos].bottom;
+		_rects.remove_at(pos);
+	} else if (joinAbove) {
+		_rects[pos - 1].bottom = r.bottom;
+	} else if (joinBelow) {
+		_rects[pos].top = r.top;
+	} else {
+		_rects.insert_at(pos, r);
+	}
+}
+
+void Region::unite(const Region &other) {
+	if (other.isEmpty())
+		return;
+	if (isEmpty()) {
+		_rects = other._rects;
+		return;
+	}
+
+	const Array<Rect> &a = _rects;
+	const Array<Rect> &b = other._rects;
+	Array<Rect> result;
+	Array<Rect> spans;
+	uint lastBand = 0;
+	uint ia = 0, ib = 0;
+	int16 y = MIN(a[0].top, b[0].top);
+
+	for (;;) {
+		// Skip bands which lie completely above the sweep line
+		while (ia < a.size() && a[ia].bottom <= y)
+			ia = bandEnd(a, ia);
+		while (ib < b.size() && b[ib].bottom <= y)
+			ib = bandEnd(b, ib);
+
+		if (ia == a.size() && ib == b.size())
+			break;
+
+		bool aActive = ia < a.size() && a[ia].top <= y;
+		bool bActive = ib < b.size() && b[ib].top <= y;
+
+		if (!aActive && !bActive) {
+			// Jump to where the next band starts
+			y = MIN(ia < a.size() ? a[ia].top : (int16)0x7FFF, ib < b.size() ? b[ib].top : (int16)0x7FFF);
+			continue;
+		}
+
+		// The output band ends wherever either input starts or stops covering
+		int16 yEnd = 0x7FFF;
+		if (ia < a.size())
+			yEnd = MIN(yEnd, aActive ? a[ia].bottom : a[ia].top);
+		if (ib < b.size())
+			yEnd = MIN(yEnd, bActive ? b[ib].bottom : b[ib].top);
+
+		spans.clear();
+		if (aActive)
+			mergeSpans(spans, a, ia, bandEnd(a, ia));
+		if (bActive)
+			mergeSpans(spans, b, ib, bandEnd(b, ib));
+
+		appendBand(result, lastBand, y, yEnd, spans);
+		y = yEnd;
+	}
+
+	_rects = result;
+}
+
+void Region::clip(const Rect &r) {
+	Array<Rect> result;
+	Array<Rect> spans;
+	uint lastBand = 0;
+
+	for (uint start = 0; start < _rects.size(); ) {
+		uint end = bandEnd(_rects, start);
+		int16 top = MAX(_rects[start].top, r.top);
+		int16 bottom = MIN(_rects[start].bottom, r.bottom);
+
+		spans.clear();
+		if (top < bottom) {
+			for (uint i = start; i < end; ++i) {
+				int16 left = MAX(_rects[i].left, r.left);
+				int16 right = MIN(_rects[i].right, r.right);
+				if (left < right)
+					spans.push_back(Rect(left, 0, right, 1));
+			}
+		}
+
+		appendBand(result, lastBand, top, bottom, spans);
+		start = end;
+	}
+
+	_rects = result;
+}
+
+void Region::translate(int16 dx, int16 dy) {
+	for (uint i = 0; i < _rects.size(); ++i)
+		_rects[i].translate(dx, dy);
+}
+
+bool Region::intersects(const Rect &r) const {
+	for (uint i = 0; i < _rects.size(); ++i) {
+		if (_rects[i].top >= r.bottom)
+			break;
+		if (_rects[i].intersects(r))
+			return true;
+	}
+
+	return false;
+}
+
+bool Region::contains(const Rect &r) const {
+	if (r.isEmpty())
+		return true;
+
+	Region covered(*this);
+	covered.clip(r);
+	return covered.getArea() == (uint32)r.width() * (uint32)r.height();
+}
+
+Rect Region::getBounds() const {
+	if (_rects.empty())
+		return Rect();
+
+	Rect bounds = _rects.front();
+	for (uint i = 1; i < _rects.size(); ++i)
+		bounds.extend(_rects[i]);
+
+	return bounds;
+}
+
+uint32 Region::getArea() const {
+	uint32 area = 0;
+	for (uint i = 0; i < _rects.size(); ++i)
+		area += (uint32)_rects[i].width() * (uint32)_rects[i].height();
+
+	return area;
+}
+
+bool Region::operator==(const Region &other) const {
+	if (_rects.size() != other._rects.size())
+		return false;
+
+	for (uint i = 0; i < _rects.size(); ++i) {
+		if (_rects[i] != other._rects[i])
+			return false;
+	}
+
+	return true;
+}
+
+} // End of namespace Common
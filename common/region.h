@@ -0,0 +1,123 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_REGION_H
+#define COMMON_REGION_H
+
+#include "common/array.h"
+#include "common/rect.h"
+
+namespace Common {
+
+/**
+ * An arbitrarily shaped area, stored as a set of non-overlapping rectangles.
+ *
+ * The rectangles are kept in y-x banded order: they are sorted by their top
+ * edge and then by their left edge, all rectangles of a band share the same
+ * top and bottom edges, and rectangles within a band never touch. Vertically
+ * adjacent bands covering the same horizontal spans are coalesced into one.
+ *
+ * This makes it cheap to merge many small, possibly overlapping rectangles
+ * (e.g. dirty areas of a screen) into the smallest number of rectangles that
+ * cover exactly the same pixels, without any of them being covered twice.
+ */
+class Region {
+public:
+	typedef Array<Rect>::const_iterator const_iterator;
+
+	Region() {}
+	explicit Region(const Rect &r) { addRect(r); }
+
+	/**
+	 * Returns true if the region does not cover any pixels.
+	 */
+	bool isEmpty() const { return _rects.empty(); }
+
+	/**
+	 * Removes all rectangles from the region.
+	 */
+	void clear() { _rects.clear(); }
+
+	/**
+	 * Adds the area of the given rectangle to the region.
+	 */
+	void addRect(const Rect &r);
+
+	/**
+	 * Adds the area of another region to this one.
+	 */
+	void unite(const Region &other);
+
+	/**
+	 * Restricts the region to the area inside the given rectangle.
+	 */
+	void clip(const Rect &r);
+
+	/**
+	 * Moves every rectangle of the region by the given offset.
+	 */
+	void translate(int16 dx, int16 dy);
+
+	/**
+	 * Returns true if the given rectangle overlaps any part of the region.
+	 */
+	bool intersects(const Rect &r) const;
+
+	/**
+	 * Returns true if the whole of the given rectangle is part of the region.
+	 */
+	bool contains(const Rect &r) const;
+
+	/**
+	 * Returns the smallest rectangle enclosing the whole region.
+	 */
+	Rect getBounds() const;
+
+	/**
+	 * Returns the number of pixels covered by the region.
+	 */
+	uint32 getArea() const;
+
+	/**
+	 * Returns the rectangles making up the region, in banded order.
+	 */
+	const Array<Rect> &getRects() const { return _rects; }
+
+	const_iterator begin() const { return _rects.begin(); }
+	const_iterator end() const { return _rects.end(); }
+
+	bool operator==(const Region &other) const;
+	bool operator!=(const Region &other) const { return !(*this == other); }
+
+private:
+	/**
+	 * Inserts the rectangle as a band of its own at the given index. No
+	 * existing band may overlap it vertically.
+	 */
+	void insertBand(uint pos, const Rect &r);
+
+	Array<Rect> _rects;
+};
+
+} // End of namespace Common
+
+#endif
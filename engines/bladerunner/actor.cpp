@@ -1203,7 +1203,7 @@ int Actor::getGoal() const {
 }
 
 void Actor::speechPlay(int sentenceId, bool voiceOver) {
-	Common::String name = Common::String::format( "%02d-%04d%s.AUD", _id, sentenceId, _vm->_languageCode.c_str());
+	Common::String name = _vm->_audioSpeech->getSpeechFileName(_id, sentenceId);
 
 	int pan = 0;
 	if (!voiceOver && _id != BladeRunnerEngine::kActorVoiceOver) {
@@ -120,7 +120,22 @@ bool ActorDialogueQueue::isEmpty() {
 	        && _timeLast == 0u;
 }
 
+void ActorDialogueQueue::preloadNext() {
+	for (uint i = 0; i < _entries.size(); ++i) {
+		if (_entries[i].isNotPause) {
+			Common::String name = _vm->_audioSpeech->getSpeechFileName(_entries[i].actorId, _entries[i].sentenceId);
+			_vm->_audioSpeech->preloadSpeech(name);
+			return;
+		}
+	}
+}
+
 void ActorDialogueQueue::tick() {
+	if ((_isPause || _vm->_audioSpeech->isPlaying()) && !_entries.empty()) {
+		// Read the upcoming line ahead so it starts without a disk stall
+		preloadNext();
+	}
+
 	if (!_vm->_audioSpeech->isPlaying()) {
 		if (_isPause) {
 			uint32 time = _vm->_time->current();
@@ -72,6 +72,7 @@ public:
 
 private:
 	void clear();
+	void preloadNext();
 };
 
 } // End of namespace BladeRunner
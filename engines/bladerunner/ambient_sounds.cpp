@@ -23,6 +23,7 @@
 #include "bladerunner/ambient_sounds.h"
 
 #include "bladerunner/audio_player.h"
+#include "bladerunner/audio_speech.h"
 #include "bladerunner/bladerunner.h"
 #include "bladerunner/game_info.h"
 #include "bladerunner/savefile.h"
@@ -122,7 +123,7 @@ void AmbientSounds::addSpeech(int actorId, int sentenceId, uint32 timeMin, uint3
 	sort(&panStartMin, &panStartMax);
 	sort(&panEndMin, &panEndMax);
 
-	Common::String name = Common::String::format( "%02d-%04d%s.AUD", actorId, sentenceId, _vm->_languageCode.c_str());
+	Common::String name = _vm->_audioSpeech->getSpeechFileName(actorId, sentenceId);
 	addSoundByName(name,
 					timeMin, timeMax,
 					volumeMin, volumeMax,
@@ -136,7 +137,7 @@ void AmbientSounds::playSound(int sfxId, int volume, int panStart, int panEnd, i
 }
 
 void AmbientSounds::playSpeech(int actorId, int sentenceId, int volume, int panStart, int panEnd, int priority) {
-	Common::String name = Common::String::format( "%02d-%04d%s.AUD", actorId, sentenceId, _vm->_languageCode.c_str());
+	Common::String name = _vm->_audioSpeech->getSpeechFileName(actorId, sentenceId);
 	_vm->_audioPlayer->playAud(name, volume * _ambientVolume / 100, panStart, panEnd, priority, kAudioPlayerOverrideVolume, Audio::Mixer::kSpeechSoundType);
 }
 
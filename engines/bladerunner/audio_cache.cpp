@@ -22,19 +22,59 @@
 
 #include "bladerunner/audio_cache.h"
 
+#include "common/config-manager.h"
 #include "common/stream.h"
 
 namespace BladeRunner {
 
 AudioCache::AudioCache() :
+	_lruHead(nullptr),
+	_lruTail(nullptr),
 	_totalSize(0),
 	_maxSize(2457600),
-	_accessCounter(0) {}
+	_hits(0),
+	_stalls(0),
+	_evictions(0) {
+	// The budget can be raised for dialogue heavy scenes, size is in KiB
+	if (ConfMan.hasKey("audio_cache_size")) {
+		int size = ConfMan.getInt("audio_cache_size");
+		if (size > 0) {
+			_maxSize = size * 1024;
+		}
+	}
+}
 
 AudioCache::~AudioCache() {
-	for (uint i = 0; i != _cacheItems.size(); ++i) {
-		free(_cacheItems[i].data);
+	for (CacheMap::iterator it = _cacheItems.begin(); it != _cacheItems.end(); ++it) {
+		free(it->_value->data);
+		delete it->_value;
+	}
+}
+
+void AudioCache::linkItem(cacheItem *item) {
+	item->lruPrev = nullptr;
+	item->lruNext = _lruHead;
+	if (_lruHead) {
+		_lruHead->lruPrev = item;
+	} else {
+		_lruTail = item;
 	}
+	_lruHead = item;
+}
+
+void AudioCache::unlinkItem(cacheItem *item) {
+	if (item->lruPrev) {
+		item->lruPrev->lruNext = item->lruNext;
+	} else {
+		_lruHead = item->lruNext;
+	}
+	if (item->lruNext) {
+		item->lruNext->lruPrev = item->lruPrev;
+	} else {
+		_lruTail = item->lruPrev;
+	}
+	item->lruPrev = nullptr;
+	item->lruNext = nullptr;
 }
 
 bool AudioCache::canAllocate(uint32 size) const {
@@ -46,69 +86,68 @@ bool AudioCache::canAllocate(uint32 size) const {
 bool AudioCache::dropOldest() {
 	Common::StackLock lock(_mutex);
 
-	if (_cacheItems.size() == 0)
-		return false;
-
-	int oldest = -1;
-	for (uint i = 1; i != _cacheItems.size(); ++i) {
-		if (_cacheItems[i].refs == 0) {
-			if (oldest == -1 || _cacheItems[i].lastAccess < _cacheItems[oldest].lastAccess) {
-				oldest = i;
-			}
-		}
+	// Walk from the least recently used end, items still being played
+	// can't be dropped
+	cacheItem *oldest = _lruTail;
+	while (oldest && oldest->refs != 0) {
+		oldest = oldest->lruPrev;
 	}
 
-	if (oldest == -1) {
+	if (oldest == nullptr) {
 		return false;
 	}
 
-	memset(_cacheItems[oldest].data, 0x00, _cacheItems[oldest].size);
-	free(_cacheItems[oldest].data);
-	_totalSize -= _cacheItems[oldest].size;
-	_cacheItems.remove_at(oldest);
+	unlinkItem(oldest);
+	_cacheItems.erase(oldest->hash);
+	memset(oldest->data, 0x00, oldest->size);
+	free(oldest->data);
+	_totalSize -= oldest->size;
+	delete oldest;
+	++_evictions;
 	return true;
 }
 
 byte *AudioCache::findByHash(int32 hash) {
 	Common::StackLock lock(_mutex);
 
-	for (uint i = 0; i != _cacheItems.size(); ++i) {
-		if (_cacheItems[i].hash == hash) {
-			_cacheItems[i].lastAccess = _accessCounter++;
-			return _cacheItems[i].data;
-		}
+	CacheMap::iterator it = _cacheItems.find(hash);
+	if (it == _cacheItems.end()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	cacheItem *item = it->_value;
+	if (item != _lruHead) {
+		unlinkItem(item);
+		linkItem(item);
+	}
+	return item->data;
 }
 
-void  AudioCache::storeByHash(int32 hash, Common::SeekableReadStream *stream) {
+void AudioCache::storeByHash(int32 hash, Common::SeekableReadStream *stream) {
 	Common::StackLock lock(_mutex);
 
 	uint32 size = stream->size();
 	byte *data = (byte *)malloc(size);
 	stream->read(data, size);
 
-	cacheItem item = {
-		hash,
-		0,
-		_accessCounter++,
-		data,
-		size
-	};
+	cacheItem *item = new cacheItem();
+	item->hash      = hash;
+	item->refs      = 0;
+	item->data      = data;
+	item->size      = size;
+	linkItem(item);
 
-	_cacheItems.push_back(item);
+	_cacheItems[hash] = item;
 	_totalSize += size;
 }
 
 void AudioCache::incRef(int32 hash) {
 	Common::StackLock lock(_mutex);
 
-	for (uint i = 0; i != _cacheItems.size(); ++i) {
-		if (_cacheItems[i].hash == hash) {
-			_cacheItems[i].refs++;
-			return;
-		}
+	CacheMap::iterator it = _cacheItems.find(hash);
+	if (it != _cacheItems.end()) {
+		it->_value->refs++;
+		return;
 	}
 	assert(false && "AudioCache::incRef: hash not found");
 }
@@ -116,14 +155,39 @@ void AudioCache::incRef(int32 hash) {
 void AudioCache::decRef(int32 hash) {
 	Common::StackLock lock(_mutex);
 
-	for (uint i = 0; i != _cacheItems.size(); ++i) {
-		if (_cacheItems[i].hash == hash) {
-			assert(_cacheItems[i].refs > 0);
-			_cacheItems[i].refs--;
-			return;
-		}
+	CacheMap::iterator it = _cacheItems.find(hash);
+	if (it != _cacheItems.end()) {
+		assert(it->_value->refs > 0);
+		it->_value->refs--;
+		return;
 	}
 	assert(false && "AudioCache::decRef: hash not found");
 }
 
+void AudioCache::notePlayLookup(bool hit) {
+	Common::StackLock lock(_mutex);
+
+	if (hit) {
+		++_hits;
+	} else {
+		++_stalls;
+	}
+}
+
+void AudioCache::getStats(uint32 &hits, uint32 &stalls, uint32 &evictions) const {
+	Common::StackLock lock(_mutex);
+
+	hits      = _hits;
+	stalls    = _stalls;
+	evictions = _evictions;
+}
+
+void AudioCache::resetStats() {
+	Common::StackLock lock(_mutex);
+
+	_hits      = 0;
+	_stalls    = 0;
+	_evictions = 0;
+}
+
 } // End of namespace BladeRunner
@@ -23,9 +23,13 @@
 #ifndef BLADERUNNER_AUDIO_CACHE_H
 #define BLADERUNNER_AUDIO_CACHE_H
 
-#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/mutex.h"
 
+namespace Common {
+class SeekableReadStream;
+}
+
 namespace BladeRunner {
 
 /*
@@ -33,19 +37,30 @@ namespace BladeRunner {
  */
 class AudioCache {
 	struct cacheItem {
-		int32   hash;
-		int     refs;
-		uint    lastAccess;
-		byte   *data;
-		uint32  size;
+		int32      hash;
+		int        refs;
+		byte      *data;
+		uint32     size;
+		cacheItem *lruPrev;   // towards the most recently used item
+		cacheItem *lruNext;   // towards the least recently used item
 	};
 
-	Common::Mutex            _mutex;
-	Common::Array<cacheItem> _cacheItems;
+	typedef Common::HashMap<int32, cacheItem *> CacheMap;
+
+	Common::Mutex _mutex;
+	CacheMap      _cacheItems;
+	cacheItem    *_lruHead;
+	cacheItem    *_lruTail;
 
 	uint32 _totalSize;
 	uint32 _maxSize;
-	uint32 _accessCounter;
+
+	uint32 _hits;
+	uint32 _stalls;
+	uint32 _evictions;
+
+	void linkItem(cacheItem *item);
+	void unlinkItem(cacheItem *item);
 
 public:
 	AudioCache();
@@ -58,6 +73,18 @@ public:
 
 	void  incRef(int32 hash);
 	void  decRef(int32 hash);
+
+	/**
+	 * Counts a lookup made right before playing a sound. A miss means the
+	 * sound has to be read from the archive while the game waits.
+	 */
+	void  notePlayLookup(bool hit);
+
+	uint32 getTotalSize() const { return _totalSize; }
+	uint32 getMaxSize() const { return _maxSize; }
+	uint   getItemCount() const { return _cacheItems.size(); }
+	void   getStats(uint32 &hits, uint32 &stalls, uint32 &evictions) const;
+	void   resetStats();
 };
 
 } // End of namespace BladeRunner
@@ -168,7 +168,9 @@ int AudioPlayer::playAud(const Common::String &name, int volume, int panFrom, in
 
 	/* Load audio resource and store in cache. Playback will happen directly from there. */
 	int32 hash = MIXArchive::getHash(name);
-	if (!_vm->_audioCache->findByHash(hash)) {
+	bool cached = _vm->_audioCache->findByHash(hash) != nullptr;
+	_vm->_audioCache->notePlayLookup(cached);
+	if (!cached) {
 		Common::SeekableReadStream *r = _vm->getResourceStream(name);
 		if (!r) {
 			//debug ("Could not get stream for %s %d - giving up", name.c_str(), priority);
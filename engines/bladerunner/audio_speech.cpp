@@ -53,6 +53,11 @@ AudioSpeech::AudioSpeech(BladeRunnerEngine *vm) {
 	_isActive = false;
 	_data = new byte[kBufferSize];
 	_channel = -1;
+	_preloadData = new byte[kBufferSize];
+	_preloadValid = false;
+	_preloads = 0;
+	_preloadHits = 0;
+	_stalls = 0;
 }
 
 AudioSpeech::~AudioSpeech() {
@@ -62,6 +67,7 @@ AudioSpeech::~AudioSpeech() {
 	}
 
 	delete[] _data;
+	delete[] _preloadData;
 }
 
 bool AudioSpeech::playSpeech(const Common::String &name, int pan) {
@@ -72,6 +78,17 @@ bool AudioSpeech::playSpeech(const Common::String &name, int pan) {
 	// Audio cache is not usable as hash function is producing collision for speech lines.
 	// It was not used in the original game either
 
+	if (_preloadValid && _preloadName == name) {
+		// The line was already read while the previous one was playing
+		SWAP(_data, _preloadData);
+		_preloadValid = false;
+		_preloadName.clear();
+		++_preloadHits;
+		return startSpeech(pan);
+	}
+
+	++_stalls;
+
 	Common::ScopedPtr<Common::SeekableReadStream> r(_vm->getResourceStream(name));
 
 	if (!r) {
@@ -94,6 +111,34 @@ bool AudioSpeech::playSpeech(const Common::String &name, int pan) {
 		return false;
 	}
 
+	return startSpeech(pan);
+}
+
+bool AudioSpeech::preloadSpeech(const Common::String &name) {
+	if (_preloadName == name) {
+		return _preloadValid;
+	}
+
+	_preloadName = name;
+	_preloadValid = false;
+
+	Common::ScopedPtr<Common::SeekableReadStream> r(_vm->getResourceStream(name));
+	if (!r || r->size() > kBufferSize) {
+		// playSpeech() will report the problem when the line is played
+		return false;
+	}
+
+	r->read(_preloadData, r->size());
+	if (r->err()) {
+		return false;
+	}
+
+	_preloadValid = true;
+	++_preloads;
+	return true;
+}
+
+bool AudioSpeech::startSpeech(int pan) {
 	AudStream *audioStream = new AudStream(_data, _vm->_shortyMode ? 33000 : -1);
 
 	_channel = _vm->_audioMixer->play(
@@ -125,9 +170,13 @@ bool AudioSpeech::isPlaying() const {
 	return _isActive;
 }
 
+Common::String AudioSpeech::getSpeechFileName(int actorId, int sentenceId) const {
+	return Common::String::format("%02d-%04d%s.AUD", actorId, sentenceId, _vm->_languageCode.c_str());
+}
+
 bool AudioSpeech::playSpeechLine(int actorId, int sentenceId, int volume, int a4, int priority) {
 	int pan = _vm->_actors[actorId]->soundPan();
-	Common::String name = Common::String::format("%02d-%04d%s.AUD", actorId, sentenceId, _vm->_languageCode.c_str());
+	Common::String name = getSpeechFileName(actorId, sentenceId);
 	return _vm->_audioPlayer->playAud(name, _speechVolume * volume / 100, pan, pan, priority, kAudioPlayerOverrideVolume, Audio::Mixer::kSpeechSoundType);
 }
 
@@ -150,4 +199,16 @@ void AudioSpeech::playSample() {
 #endif // BLADERUNNER_ORIGINAL_BUGS
 }
 
+void AudioSpeech::getStats(uint32 &preloads, uint32 &preloadHits, uint32 &stalls) const {
+	preloads    = _preloads;
+	preloadHits = _preloadHits;
+	stalls      = _stalls;
+}
+
+void AudioSpeech::resetStats() {
+	_preloads    = 0;
+	_preloadHits = 0;
+	_stalls      = 0;
+}
+
 } // End of namespace BladeRunner
@@ -41,11 +41,28 @@ class AudioSpeech {
 	int   _channel;
 	byte *_data;
 
+	// The next line of a dialogue is read here while the current one plays
+	byte          *_preloadData;
+	bool           _preloadValid;
+	Common::String _preloadName;
+
+	uint32 _preloads;
+	uint32 _preloadHits;
+	uint32 _stalls;
+
 public:
 	AudioSpeech(BladeRunnerEngine *vm);
 	~AudioSpeech();
 
+	/**
+	 * Returns the name of the AUD file holding the given line, in the
+	 * current language. Every place that plays or preloads speech uses
+	 * this, so a preloaded line is always the one later played.
+	 */
+	Common::String getSpeechFileName(int actorId, int sentenceId) const;
+
 	bool playSpeech(const Common::String &name, int pan = 0);
+	bool preloadSpeech(const Common::String &name);
 	void stopSpeech();
 	bool isPlaying() const;
 
@@ -55,7 +72,11 @@ public:
 	int getVolume() const;
 	void playSample();
 
+	void getStats(uint32 &preloads, uint32 &preloadHits, uint32 &stalls) const;
+	void resetStats();
+
 private:
+	bool startSpeech(int pan);
 	void ended();
 	static void mixerChannelEnded(int channel, void *data);
 };
@@ -107,6 +107,8 @@ BladeRunnerEngine::BladeRunnerEngine(OSystem *syst, const ADGameDescription *des
 	_vqaIsPlaying       = false;
 	_vqaStopIsRequested = false;
 
+	_surfaceScreenValid = false;
+
 	_actorIsSpeaking           = false;
 	_actorSpeakStopIsRequested = false;
 
@@ -508,6 +510,8 @@ bool BladeRunnerEngine::startup(bool hasSavegames) {
 
 	_surfaceFront.create(640, 480, screenPixelFormat());
 	_surfaceBack.create(640, 480, screenPixelFormat());
+	_surfaceScreen.create(640, 480, screenPixelFormat());
+	_surfaceScreenValid = false;
 
 	_time = new Time(this);
 
@@ -922,6 +926,7 @@ void BladeRunnerEngine::shutdown() {
 	delete _time;
 	_time = nullptr;
 
+	_surfaceScreen.free();
 	_surfaceBack.free();
 	_surfaceFront.free();
 
@@ -2276,9 +2281,55 @@ void BladeRunnerEngine::ISez(const Common::String &str) {
 	debug("\t%s", str.c_str());
 }
 
-void BladeRunnerEngine::blitToScreen(const Graphics::Surface &src) const {
+void BladeRunnerEngine::blitToScreen(const Graphics::Surface &src) {
 	_framelimiter->wait();
-	_system->copyRectToScreen(src.getPixels(), src.pitch, 0, 0, src.w, src.h);
+
+	if (!_surfaceScreenValid || src.w != _surfaceScreen.w || src.h != _surfaceScreen.h || src.format != _surfaceScreen.format) {
+		_system->copyRectToScreen(src.getPixels(), src.pitch, 0, 0, src.w, src.h);
+		if (src.w == _surfaceScreen.w && src.h == _surfaceScreen.h && src.format == _surfaceScreen.format) {
+			_surfaceScreen.copyRectToSurface(src, 0, 0, Common::Rect(src.w, src.h));
+			_surfaceScreenValid = true;
+		}
+		_system->updateScreen();
+		return;
+	}
+
+	// Most of the frame is usually the same as the last one, only send
+	// the changed part of each band of lines to the backend
+	const int bandHeight = 16;
+	const int bpp = src.format.bytesPerPixel;
+	const int lineSize = src.w * bpp;
+	for (int bandTop = 0; bandTop < src.h; bandTop += bandHeight) {
+		int bandBottom = MIN(bandTop + bandHeight, (int)src.h);
+		int left = src.w;
+		int right = 0;
+		for (int y = bandTop; y < bandBottom; ++y) {
+			const byte *srcLine = (const byte *)src.getBasePtr(0, y);
+			const byte *screenLine = (const byte *)_surfaceScreen.getBasePtr(0, y);
+			if (memcmp(srcLine, screenLine, lineSize) == 0) {
+				continue;
+			}
+
+			int x = 0;
+			while (x < left && memcmp(srcLine + x * bpp, screenLine + x * bpp, bpp) == 0) {
+				++x;
+			}
+			left = MIN(left, x);
+
+			x = src.w;
+			while (x > right && memcmp(srcLine + (x - 1) * bpp, screenLine + (x - 1) * bpp, bpp) == 0) {
+				--x;
+			}
+			right = MAX(right, x);
+		}
+
+		if (left < right) {
+			Common::Rect rect(left, bandTop, right, bandBottom);
+			_system->copyRectToScreen(src.getBasePtr(left, bandTop), src.pitch, left, bandTop, rect.width(), rect.height());
+			_surfaceScreen.copyRectToSurface(src, left, bandTop, rect);
+		}
+	}
+
 	_system->updateScreen();
 }
 
@@ -189,6 +189,11 @@ public:
 	Graphics::Surface  _surfaceFront;
 	Graphics::Surface  _surfaceBack;
 
+	// Copy of what was last sent to the backend, used to find the changed
+	// parts of the next frame
+	Graphics::Surface  _surfaceScreen;
+	bool               _surfaceScreenValid;
+
 	ZBuffer           *_zbuffer;
 
 	Common::RandomSource _rnd;
@@ -319,7 +324,7 @@ public:
 
 	void ISez(const Common::String &str);
 
-	void blitToScreen(const Graphics::Surface &src) const;
+	void blitToScreen(const Graphics::Surface &src);
 	Graphics::Surface generateThumbnail() const;
 
 	GUI::Debugger *getDebugger();
@@ -23,6 +23,8 @@
 #include "bladerunner/debugger.h"
 
 #include "bladerunner/actor.h"
+#include "bladerunner/audio_cache.h"
+#include "bladerunner/audio_speech.h"
 #include "bladerunner/bladerunner.h"
 #include "bladerunner/boundingbox.h"
 #include "bladerunner/combat.h"
@@ -134,6 +136,7 @@ Debugger::Debugger(BladeRunnerEngine *vm) : GUI::Debugger() {
 	registerCmd("region", WRAP_METHOD(Debugger, cmdRegion));
 	registerCmd("click", WRAP_METHOD(Debugger, cmdClick));
 	registerCmd("difficulty", WRAP_METHOD(Debugger, cmdDifficulty));
+	registerCmd("audiocache", WRAP_METHOD(Debugger, cmdAudioCache));
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	registerCmd("effect", WRAP_METHOD(Debugger, cmdEffect));
@@ -1834,6 +1837,34 @@ bool Debugger::cmdDifficulty(int argc, const char **argv) {
 	}
 	return true;
 }
+bool Debugger::cmdAudioCache(int argc, const char **argv) {
+	bool reset = false;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		reset = true;
+	} else if (argc != 1) {
+		debugPrintf("Show hit and stall counters of the audio cache and the speech preloading\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	uint32 hits, stalls, evictions;
+	_vm->_audioCache->getStats(hits, stalls, evictions);
+	debugPrintf("Audio cache: %u items, %u of %u bytes used\n", _vm->_audioCache->getItemCount(), _vm->_audioCache->getTotalSize(), _vm->_audioCache->getMaxSize());
+	debugPrintf("  hits: %u, stalls: %u, evictions: %u\n", hits, stalls, evictions);
+
+	uint32 preloads, preloadHits;
+	_vm->_audioSpeech->getStats(preloads, preloadHits, stalls);
+	debugPrintf("Speech: %u lines preloaded, %u played from preload, %u stalls\n", preloads, preloadHits, stalls);
+
+	if (reset) {
+		_vm->_audioCache->resetStats();
+		_vm->_audioSpeech->resetStats();
+		debugPrintf("Counters reset\n");
+	}
+	return true;
+}
+
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 bool Debugger::cmdEffect(int argc, const char **argv) {
@@ -61,6 +61,12 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_m13               = 0;
 	_m23               = 0;
 
+	for (int i = 0; i < 256; ++i) {
+		_litColors[i].stamp = 0;
+	}
+	_litColorsStamp        = 1;
+	_litColorsPaletteIndex = 0xFFFFFFFF;
+
 	_shadowPolygonDefault[ 0] = Vector3( 16.0f,  96.0f, 0.0f);
 	_shadowPolygonDefault[ 1] = Vector3( 16.0f, 160.0f, 0.0f);
 	_shadowPolygonDefault[ 2] = Vector3( 64.0f, 192.0f, 0.0f);
@@ -537,6 +543,72 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	}
 }
 
+template<typename PixelType>
+static void drawSliceSpan(uint16 *zbufferLine, PixelType *line, int width, int x, int xEnd, uint16 z, uint32 color) {
+	// Pixels past the right edge of a narrower surface all land on its
+	// last column, as they did with per-pixel clipping
+	int xVisibleEnd = MIN(xEnd, width);
+	for (; x < xVisibleEnd; ++x) {
+		if (z < zbufferLine[x]) {
+			zbufferLine[x] = z;
+			line[x] = (PixelType)color;
+		}
+	}
+	for (; x < xEnd; ++x) {
+		if (z < zbufferLine[x]) {
+			zbufferLine[x] = z;
+			line[width - 1] = (PixelType)color;
+		}
+	}
+}
+
+uint32 SliceRenderer::getLitColor(const SliceAnimations::Palette &palette, int index, const Color256 &aescColor) {
+	LitColor &lit = _litColors[index];
+	if (lit.stamp != _litColorsStamp) {
+		const Color256 &color = palette.color[index];
+		lit.r = (int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536;
+		lit.g = (int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536;
+		lit.b = (int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536;
+		lit.value = packLitColor(lit.r, lit.g, lit.b);
+		lit.stamp = _litColorsStamp;
+	}
+
+	if (aescColor.r == 0 && aescColor.g == 0 && aescColor.b == 0) {
+		return lit.value;
+	}
+	return packLitColor(lit.r + aescColor.r, lit.g + aescColor.g, lit.b + aescColor.b);
+}
+
+uint32 SliceRenderer::packLitColor(int r, int g, int b) const {
+	// Components are 5 bit values stored in bytes, keep their wrap around
+	Color256 color;
+	color.r = r;
+	color.g = g;
+	color.b = b;
+
+	int bladeToScummVmConstant = 256 / 32;
+	return _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+}
+
+void SliceRenderer::updateLitColors() {
+	if (_lightsColor.r == _litColorsLights.r && _lightsColor.g == _litColorsLights.g && _lightsColor.b == _litColorsLights.b &&
+	    _setEffectColor.r == _litColorsSetEffect.r && _setEffectColor.g == _litColorsSetEffect.g && _setEffectColor.b == _litColorsSetEffect.b &&
+	    _framePaletteIndex == _litColorsPaletteIndex) {
+		return;
+	}
+
+	_litColorsLights = _lightsColor;
+	_litColorsSetEffect = _setEffectColor;
+	_litColorsPaletteIndex = _framePaletteIndex;
+
+	if (++_litColorsStamp == 0) {
+		for (int i = 0; i < 256; ++i) {
+			_litColors[i].stamp = 0;
+		}
+		_litColorsStamp = 1;
+	}
+}
+
 void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine) {
 	if (slice < 0 || (uint32)slice >= _frameSliceCount) {
 		return;
@@ -544,6 +616,12 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 
 	SliceAnimations::Palette &palette = _vm->_sliceAnimations->getPalette(_framePaletteIndex);
 
+	if (advanced) {
+		updateLitColors();
+	}
+
+	void *line = surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+
 	byte *p = (byte *)_sliceFramePtr + 0x20 + 4 * slice;
 
 	uint32 polyOffset = READ_LE_UINT32(p);
@@ -572,26 +650,31 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 				int vertexZ = (_m21lookup[p[0]] + _m22lookup[p[1]] + _m23) / 64;
 
 				if (vertexZ >= 0 && vertexZ < 65536) {
-					uint32 outColor = palette.value[p[2]];
-					if (advanced) {
-						Color256 aescColor = { 0, 0, 0 };
-						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
-
-						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536) + aescColor.b;
-
-						int bladeToScummVmConstant = 256 / 32;
-						outColor = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+					// Skip spans which are hidden entirely before working out their colour
+					int x = previousVertexX;
+					while (x != vertexX && vertexZ >= zbufferLine[x]) {
+						++x;
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufferLine[x]) {
-							zbufferLine[x] = (uint16)vertexZ;
+					if (x != vertexX) {
+						uint32 outColor = palette.value[p[2]];
+						if (advanced) {
+							Color256 aescColor = { 0, 0, 0 };
+							_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
+
+							outColor = getLitColor(palette, p[2], aescColor);
+						}
 
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
+						switch (surface.format.bytesPerPixel) {
+						case 1:
+							drawSliceSpan(zbufferLine, (uint8 *)line, surface.w, x, vertexX, vertexZ, outColor);
+							break;
+						case 2:
+							drawSliceSpan(zbufferLine, (uint16 *)line, surface.w, x, vertexX, vertexZ, outColor);
+							break;
+						case 4:
+							drawSliceSpan(zbufferLine, (uint32 *)line, surface.w, x, vertexX, vertexZ, outColor);
+							break;
 						}
 					}
 				}
@@ -27,6 +27,7 @@
 #include "bladerunner/vector.h"
 #include "bladerunner/view.h"
 #include "bladerunner/matrix.h"
+#include "bladerunner/slice_animations.h"
 
 #include "common/rect.h"
 
@@ -89,6 +90,20 @@ class SliceRenderer {
 	Color _setEffectColor;
 	Color _lightsColor;
 
+	// Lit palette colours for the current lights, set effect colour and
+	// palette. Entries are filled on first use and stay valid, also across
+	// frames, until one of the inputs changes.
+	struct LitColor {
+		uint32 stamp;
+		int    r, g, b;
+		uint32 value;
+	};
+	LitColor _litColors[256];
+	uint32   _litColorsStamp;
+	Color    _litColorsLights;
+	Color    _litColorsSetEffect;
+	uint32   _litColorsPaletteIndex;
+
 	Graphics::PixelFormat _pixelFormat;
 
 public:
@@ -114,6 +129,9 @@ private:
 	Matrix3x2 calculateFacingRotationMatrix();
 	void loadFrame(int animation, int frame);
 
+	void updateLitColors();
+	uint32 getLitColor(const SliceAnimations::Palette &palette, int index, const Color256 &aescColor);
+	uint32 packLitColor(int r, int g, int b) const;
 	void drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine);
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
@@ -23,6 +23,7 @@
 #include "glk/debugger.h"
 #include "glk/glk.h"
 #include "glk/raw_decoder.h"
+#include "glk/screen.h"
 #include "common/file.h"
 #include "graphics/managed_surface.h"
 #include "image/png.h"
@@ -31,6 +32,7 @@ namespace Glk {
 
 Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("dumppic", WRAP_METHOD(Debugger, cmdDumpPic));
+	registerCmd("screenstats", WRAP_METHOD(Debugger, cmdScreenStats));
 }
 
 int Debugger::strToInt(const char *s) {
@@ -100,6 +102,20 @@ bool Debugger::cmdDumpPic(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdScreenStats(int argc, const char **argv) {
+	const Graphics::Screen::UpdateStats &stats = g_vm->_screen->getUpdateStats();
+	uint32 screenSize = g_vm->_screen->w * g_vm->_screen->h;
+
+	debugPrintf("Frames: %u, of which full screen: %u\n", stats._frames, stats._fullFrames);
+	debugPrintf("Last frame: %u pixels in %u rects (%u%% of the screen)\n", stats._pixels, stats._rects,
+		screenSize ? stats._pixels * 100 / screenSize : 0);
+	if (stats._frames)
+		debugPrintf("Average: %u pixels per frame (%u%% of the screen)\n", stats._totalPixels / stats._frames,
+			screenSize ? (uint32)((uint64)stats._totalPixels * 100 / stats._frames / screenSize) : 0);
+
+	return true;
+}
+
 void Debugger::saveRawPicture(const RawDecoder &rd, Common::WriteStream &ws) {
 #ifdef USE_PNG
 	const Graphics::Surface *surface = rd.getSurface();
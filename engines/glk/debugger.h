@@ -43,6 +43,11 @@ private:
 	 * Dump a picture
 	 */
 	bool cmdDumpPic(int argc, const char **argv);
+
+	/**
+	 * Show how much of the screen gets copied to the system each frame
+	 */
+	bool cmdScreenStats(int argc, const char **argv);
 protected:
 	/**
 	 * Convert a numeric string to an integer
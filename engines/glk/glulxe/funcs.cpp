@@ -26,10 +26,9 @@ namespace Glk {
 namespace Glulxe {
 
 void Glulxe::enter_function(uint funcaddr, uint argc, uint *argv) {
-	uint ix, jx;
+	uint ix;
 	acceleration_func accelFunc;
-	int locallen;
-	int functype;
+	funcheader_t header;
 	uint modeaddr, opaddr, val;
 	int loctype, locnum;
 	uint addr = funcaddr;
@@ -45,94 +44,49 @@ void Glulxe::enter_function(uint funcaddr, uint argc, uint *argv) {
 
 	profile_in(addr, stackptr, false);
 
-	/* Check the Glulx type identifier byte. */
-	functype = Mem1(addr);
-	if (functype != 0xC0 && functype != 0xC1) {
-		if (functype >= 0xC0 && functype <= 0xDF)
-			fatal_error_i("Call to unknown type of function.", addr);
-		else
-			fatal_error_i("Call to non-function.", addr);
-	}
-	addr++;
-
-	/* Bump the frameptr to the top. */
-	frameptr = stackptr;
-
-	/* Go through the function's locals-format list, copying it to the
-	   call frame. At the same time, we work out how much space the locals
-	   will actually take up. (Including padding.) */
-	ix = 0;
-	locallen = 0;
-	while (1) {
-		/* Grab two bytes from the locals-format list. These are
-		   unsigned (0..255 range). */
-		loctype = Mem1(addr);
-		addr++;
-		locnum = Mem1(addr);
-		addr++;
-
-		/* Copy them into the call frame. */
-		StkW1(frameptr + 8 + 2 * ix, loctype);
-		StkW1(frameptr + 8 + 2 * ix + 1, locnum);
-		ix++;
-
-		/* If the type is zero, we're done, except possibly for two more
-		   zero bytes in the call frame (to ensure 4-byte alignment.) */
-		if (loctype == 0) {
-			/* Make sure ix is even. */
-			if (ix & 1) {
-				StkW1(frameptr + 8 + 2 * ix, 0);
-				StkW1(frameptr + 8 + 2 * ix + 1, 0);
-				ix++;
-			}
-			break;
-		}
-
-		/* Pad to 4-byte or 2-byte alignment if these locals are 4 or 2
-		   bytes long. */
-		if (loctype == 4) {
-			while (locallen & 3)
-				locallen++;
-		} else if (loctype == 2) {
-			while (locallen & 1)
-				locallen++;
-		} else if (loctype == 1) {
-			/* no padding */
+	/* Functions in ROM can't change, so their headers only have to be
+	   parsed once. */
+	if (addr < ramstart) {
+		FuncHeaderCache::const_iterator it = funcheader_cache.find(addr);
+		if (it == funcheader_cache.end()) {
+			parse_funcheader(addr, &header);
+			funcheader_cache[addr] = header;
 		} else {
-			fatal_error("Illegal local type in locals-format list.");
+			header = it->_value;
 		}
-
-		/* Add the length of the locals themselves. */
-		locallen += (loctype * locnum);
+	} else {
+		parse_funcheader(addr, &header);
 	}
 
-	/* Pad the locals to 4-byte alignment. */
-	while (locallen & 3)
-		locallen++;
+	/* Bump the frameptr to the top. */
+	frameptr = stackptr;
 
-	/* We now know how long the locals-frame and locals segments are. */
-	localsbase = frameptr + 8 + 2 * ix;
-	valstackbase = localsbase + locallen;
+	/* We know how long the locals-frame and locals segments are. */
+	localsbase = frameptr + 8 + header.framelen;
+	valstackbase = localsbase + header.locallen;
 
 	/* Test for stack overflow. */
-	/* This really isn't good enough; if the format list overflowed the
-	   stack, we've already written outside the stack array. */
 	if (valstackbase >= stacksize)
 		fatal_error("Stack overflow in function call.");
 
+	/* Copy the function's locals-format list to the call frame, padding
+	   it with two zero bytes if needed to ensure 4-byte alignment. */
+	memcpy(stack + frameptr + 8, memmap + addr + 1, header.formatlen);
+	for (ix = header.formatlen; ix < header.framelen; ix++)
+		StkW1(frameptr + 8 + ix, 0);
+
 	/* Fill in the beginning of the stack frame. */
-	StkW4(frameptr + 4, 8 + 2 * ix);
-	StkW4(frameptr, 8 + 2 * ix + locallen);
+	StkW4(frameptr + 4, 8 + header.framelen);
+	StkW4(frameptr, 8 + header.framelen + header.locallen);
 
 	/* Set the stackptr and PC. */
 	stackptr = valstackbase;
-	pc = addr;
+	pc = addr + 1 + header.formatlen;
 
 	/* Zero out all the locals. */
-	for (jx = 0; jx < (uint)locallen; jx++)
-		StkW1(localsbase + jx, 0);
+	memset(stack + localsbase, 0, header.locallen);
 
-	if (functype == 0xC0) {
+	if (header.functype == 0xC0) {
 		/* Push the function arguments on the stack. The locals have already
 		   been zeroed. */
 		if (stackptr + 4 * (argc + 1) >= stacksize)
@@ -196,6 +150,67 @@ void Glulxe::enter_function(uint funcaddr, uint argc, uint *argv) {
 	debugger_check_func_breakpoint(funcaddr);
 }
 
+void Glulxe::parse_funcheader(uint addr, funcheader_t *header) {
+	uint ix;
+	int loctype, locnum;
+	int locallen;
+	uint funcaddr = addr;
+
+	/* Check the Glulx type identifier byte. */
+	header->functype = Mem1(addr);
+	if (header->functype != 0xC0 && header->functype != 0xC1) {
+		if (header->functype >= 0xC0 && header->functype <= 0xDF)
+			fatal_error_i("Call to unknown type of function.", funcaddr);
+		else
+			fatal_error_i("Call to non-function.", funcaddr);
+	}
+	addr++;
+
+	/* Go through the function's locals-format list, working out how much
+	   space the locals will actually take up. (Including padding.) */
+	ix = 0;
+	locallen = 0;
+	while (1) {
+		/* Grab two bytes from the locals-format list. These are
+		   unsigned (0..255 range). */
+		loctype = Mem1(addr);
+		addr++;
+		locnum = Mem1(addr);
+		addr++;
+		ix++;
+
+		/* If the type is zero, we're done, except possibly for two more
+		   zero bytes in the call frame (to ensure 4-byte alignment.) */
+		if (loctype == 0)
+			break;
+
+		/* Pad to 4-byte or 2-byte alignment if these locals are 4 or 2
+		   bytes long. */
+		if (loctype == 4) {
+			while (locallen & 3)
+				locallen++;
+		} else if (loctype == 2) {
+			while (locallen & 1)
+				locallen++;
+		} else if (loctype == 1) {
+			/* no padding */
+		} else {
+			fatal_error("Illegal local type in locals-format list.");
+		}
+
+		/* Add the length of the locals themselves. */
+		locallen += (loctype * locnum);
+	}
+
+	/* Pad the locals to 4-byte alignment. */
+	while (locallen & 3)
+		locallen++;
+
+	header->formatlen = 2 * ix;
+	header->framelen = 2 * (ix + (ix & 1));
+	header->locallen = locallen;
+}
+
 void Glulxe::leave_function() {
 	profile_out(stackptr);
 	stackptr = frameptr;
@@ -46,7 +46,7 @@ Glulxe::Glulxe(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst,
 		// serial
 		max_undo_level(8), undo_chain_size(0), undo_chain_num(0), undo_chain(nullptr), ramcache(nullptr),
 		// string
-		iosys_mode(0), iosys_rock(0), tablecache_valid(false), glkio_unichar_han_ptr(nullptr) {
+		iosys_mode(0), iosys_rock(0), tablecache_valid(false), stringcache_size(0), glkio_unichar_han_ptr(nullptr) {
 	g_vm = this;
 
 	glkopInit();
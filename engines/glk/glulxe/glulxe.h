@@ -25,6 +25,8 @@
 
 #include "common/scummsys.h"
 #include "common/random.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "glk/glk_api.h"
 #include "glk/glulxe/glulxe_types.h"
 
@@ -145,6 +147,19 @@ private:
 
 	/**@}*/
 
+	/**
+	 * \defgroup func fields
+	 * @{
+	 */
+
+	/**
+	 * Predecoded headers of the functions in ROM, keyed by address
+	 */
+	typedef Common::HashMap<uint, funcheader_t> FuncHeaderCache;
+	FuncHeaderCache funcheader_cache;
+
+	/**@}*/
+
 	/**
 	 * \defgroup serial fields
 	 * @{
@@ -180,6 +195,15 @@ private:
 	bool tablecache_valid;
 	cacheblock_t tablecache;
 
+	/**
+	 * Decoded text of compressed strings in ROM, keyed by address. It is only used while the
+	 * decoding table is in ROM as well, so it only needs to be dropped when the table changes.
+	 */
+	typedef Common::HashMap<uint, Common::Array<uint32> > StringCache;
+	StringCache stringcache;
+	uint stringcache_size;
+	Common::Array<uint32> stringcache_text;
+
 	/* This misbehaves if a Glk function has more than one S argument. */
 #define STATIC_TEMP_BUFSIZE (127)
 	char temp_buf[STATIC_TEMP_BUFSIZE + 1];
@@ -388,6 +412,23 @@ protected:
 	void buildcache(cacheblock_t *cablist, uint nodeaddr, int depth, int mask);
 	void dumpcache(cacheblock_t *cablist, int count, int indent);
 
+	/**
+	 * Print a string from the decoded string cache
+	 */
+	void stream_cached_string(const Common::Array<uint32> &text);
+
+	/**@}*/
+
+	/**
+	 * \defgroup func support methods
+	 * @{
+	 */
+
+	/**
+	 * Parse the type byte and the locals-format list of the function at addr.
+	 */
+	void parse_funcheader(uint addr, funcheader_t *header);
+
 	/**@}*/
 public:
 	/**
@@ -364,6 +364,18 @@ typedef accelentry_struct accelentry_t;
 
 #define ACCEL_HASH_SIZE (511)
 
+/**
+ * The parts of a function header that enter_function() needs. These are worked out once for
+ * each function in ROM, instead of parsing the locals-format list on every call.
+ */
+struct funcheader_struct {
+	int functype;
+	uint formatlen;    ///< length of the locals-format list in the game file
+	uint framelen;     ///< length of the locals-format list in the call frame, padded to 4 bytes
+	uint locallen;     ///< length of the locals segment
+};
+typedef funcheader_struct funcheader_t;
+
 struct heapblock_struct {
 	uint addr;
 	uint len;
@@ -398,12 +410,17 @@ enum iosys {
 	iosys_Glk    = 2
 };
 
-#define CACHEBITS (4)
+#define CACHEBITS (8)
 #define CACHESIZE (1 << CACHEBITS)
-#define CACHEMASK (15)
+#define CACHEMASK (CACHESIZE - 1)
+
+/* Compressed strings in ROM are cached after decoding, up to this many characters in total.
+   Characters which are printed through the Unicode handler are marked with STRINGCACHE_UNI. */
+#define STRINGCACHE_MAXCHARS (0x40000)
+#define STRINGCACHE_UNI (0x80000000)
 
 struct cacheblock_struct {
-	int depth; /* 1 to 4 */
+	int depth; /* 1 to CACHEBITS */
 	int type;
 	union {
 		struct cacheblock_struct *branches;
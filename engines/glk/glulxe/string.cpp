@@ -166,10 +166,25 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 	int alldone = false;
 	int substring = (inmiddle != 0);
 	uint ival;
+	uint cacheaddr = 0;
 
 	if (!addr)
 		fatal_error("Called stream_string with null address.");
 
+	/* Compressed strings in ROM which are printed straight to Glk are
+	   cached after they have been decoded once. The cached text is only
+	   valid while the decoding table is in ROM as well. */
+	if (inmiddle == 0 && iosys_mode == iosys_Glk && tablecache_valid
+			&& addr < ramstart && Mem1(addr) == 0xE1) {
+		StringCache::const_iterator it = stringcache.find(addr);
+		if (it != stringcache.end()) {
+			stream_cached_string(it->_value);
+			return;
+		}
+		cacheaddr = addr;
+		stringcache_text.clear();
+	}
+
 	while (!alldone) {
 
 		if (inmiddle == 0) {
@@ -245,6 +260,8 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 						switch (iosys_mode) {
 						case iosys_Glk:
 							glk_put_char(cab->u.ch);
+							if (cacheaddr)
+								stringcache_text.push_back(cab->u.ch);
 							break;
 						case iosys_Filter:
 							ival = cab->u.ch & 0xFF;
@@ -263,6 +280,8 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 						switch (iosys_mode) {
 						case iosys_Glk:
 							(this->*glkio_unichar_han_ptr)(cab->u.uch);
+							if (cacheaddr)
+								stringcache_text.push_back(cab->u.uch | STRINGCACHE_UNI);
 							break;
 						case iosys_Filter:
 							ival = cab->u.uch;
@@ -280,8 +299,11 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 					case 0x03: /* C string */
 						switch (iosys_mode) {
 						case iosys_Glk:
-							for (tmpaddr = cab->u.addr; (ch = Mem1(tmpaddr)) != '\0'; tmpaddr++)
+							for (tmpaddr = cab->u.addr; (ch = Mem1(tmpaddr)) != '\0'; tmpaddr++) {
 								glk_put_char(ch);
+								if (cacheaddr)
+									stringcache_text.push_back(ch);
+							}
 							cablist = tablecache.u.branches;
 							break;
 						case iosys_Filter:
@@ -303,8 +325,11 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 					case 0x05: /* C Unicode string */
 						switch (iosys_mode) {
 						case iosys_Glk:
-							for (tmpaddr = cab->u.addr; (ival = Mem4(tmpaddr)) != 0; tmpaddr += 4)
+							for (tmpaddr = cab->u.addr; (ival = Mem4(tmpaddr)) != 0; tmpaddr += 4) {
 								(this->*glkio_unichar_han_ptr)(ival);
+								if (cacheaddr)
+									stringcache_text.push_back(ival | STRINGCACHE_UNI);
+							}
 							cablist = tablecache.u.branches;
 							break;
 						case iosys_Filter:
@@ -329,6 +354,9 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 					case 0x0B: {
 						uint oaddr;
 						int otype;
+						/* Indirect references may print anything, so the
+						   string can't be cached. */
+						cacheaddr = 0;
 						oaddr = cab->u.addr;
 						if (cab->type >= 0x09)
 							oaddr = Mem4(oaddr);
@@ -599,6 +627,15 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 		if (!substring) {
 			/* Just get straight out. */
 			alldone = true;
+
+			if (cacheaddr) {
+				if (stringcache_size + stringcache_text.size() > STRINGCACHE_MAXCHARS) {
+					stringcache.clear();
+					stringcache_size = 0;
+				}
+				stringcache[cacheaddr] = stringcache_text;
+				stringcache_size += stringcache_text.size();
+			}
 		} else {
 			/* Pop a stub and see what's to be done. */
 			addr = pop_callstub_string(&bitnum);
@@ -626,6 +663,8 @@ void Glulxe::stream_set_table(uint addr) {
 		tablecache.u.branches = nullptr;
 		tablecache_valid = false;
 	}
+	stringcache.clear();
+	stringcache_size = 0;
 
 	stringtable = addr;
 
@@ -740,6 +779,16 @@ void Glulxe::dropcache(cacheblock_t *cablist) {
 	glulx_free(cablist);
 }
 
+void Glulxe::stream_cached_string(const Common::Array<uint32> &text) {
+	for (uint ix = 0; ix < text.size(); ix++) {
+		uint32 ch = text[ix];
+		if (ch & STRINGCACHE_UNI)
+			(this->*glkio_unichar_han_ptr)(ch & ~STRINGCACHE_UNI);
+		else
+			glk_put_char(ch);
+	}
+}
+
 char *Glulxe::make_temp_string(uint addr) {
 	int ix, len;
 	uint addr2;
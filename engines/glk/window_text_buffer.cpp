@@ -26,6 +26,7 @@
 #include "glk/screen.h"
 #include "glk/selection.h"
 #include "glk/unicode.h"
+#include "common/ptr.h"
 
 namespace Glk {
 
@@ -40,8 +41,8 @@ TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : TextWindow(win
 		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
 		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
 		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
-		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
-		_copyBuf(0), _copyPos(0) {
+		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _lineWidth(0), _lineWidthLen(0),
+		_spaced(0), _dashed(0), _copyBuf(0), _copyPos(0) {
 	_type = wintype_TextBuffer;
 	_history.resize(HISTORYLEN);
 
@@ -235,7 +236,8 @@ void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
 
-	for (int i = 0; i < _scrollMax; i++)
+	// Only the rows in view get drawn, so there's no need to flag the rest of the scrollback
+	for (int i = _scrollPos; i < _scrollPos + _height && i < _scrollBack; i++)
 		_lines[i]._dirty = true;
 }
 
@@ -319,6 +321,7 @@ void TextBufferWindow::putText(const char *buf, int len, int pos, int oldlen) {
 		}
 	}
 	_numChars += diff;
+	_lineWidthLen = 0;
 
 	if (_inBuf) {
 		if (_inCurs >= pos + oldlen)
@@ -351,6 +354,7 @@ void TextBufferWindow::putTextUni(const uint32 *buf, int len, int pos, int oldle
 			_attrs[pos + i].set(style_Input);
 	}
 	_numChars += diff;
+	_lineWidthLen = 0;
 
 	if (_inBuf) {
 		if (_inCurs >= pos + oldlen)
@@ -426,6 +430,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			_dashed++;
 			if (_dashed == 2) {
 				_numChars--;
+				_lineWidthLen = 0;
 				if (_font._dashes == 2)
 					ch = UNI_NDASH;
 				else
@@ -433,6 +438,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			}
 			if (_dashed == 3) {
 				_numChars--;
+				_lineWidthLen = 0;
 				ch = UNI_MDASH;
 				_dashed = 0;
 			}
@@ -484,7 +490,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			&& !_styles[_attrs[linelen - 1].style].reverse)
 		linelen--;
 
-	if (calcWidth(_chars, _attrs, 0, linelen, -1) >= pw) {
+	if (calcLineWidth(linelen) >= pw) {
 		bpoint = _numChars;
 
 		for (i = _numChars - 1; i > 0; i--) {
@@ -513,6 +519,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 bool TextBufferWindow::unputCharUni(uint32 ch) {
 	if (_numChars > 0 && _chars[_numChars - 1] == ch) {
 		_numChars--;
+		_lineWidthLen = 0;
 		touch(0);
 		return true;
 	}
@@ -536,6 +543,7 @@ void TextBufferWindow::clear() {
 	_dashed = 0;
 
 	_numChars = 0;
+	_lineWidthLen = 0;
 
 	for (i = 0; i < _scrollBack; i++) {
 		_lines[i]._len = 0;
@@ -793,6 +801,7 @@ void TextBufferWindow::cancelLineEvent(Event *ev) {
 		putCharUni('\n');
 	} else {
 		_numChars = _inFence;
+		_lineWidthLen = 0;
 		touch(0);
 	}
 
@@ -814,6 +823,7 @@ void TextBufferWindow::redraw() {
 	int selrow, selchar, sx0, sx1, selleft, selright;
 	bool selBuf;
 	int tx, tsc, tsw, lsc, rsc;
+	Common::ScopedPtr<TextBufferRow> selLine;
 	Screen &screen = *g_vm->_screen;
 
 	Window::redraw();
@@ -849,12 +859,19 @@ void TextBufferWindow::redraw() {
 		if (selrow)
 			_lines[i]._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
-
 		// skip if we can
-		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
+		if (!_lines[i]._dirty && !_lines[i]._repaint && !Windows::_forceRedraw && _scrollPos == 0)
 			continue;
 
+		// Highlighting a selection reverses the attributes, so that's done on a copy of the row
+		if (selrow) {
+			if (selLine)
+				*selLine = _lines[i];
+			else
+				selLine.reset(new TextBufferRow(_lines[i]));
+		}
+		TextBufferRow &ln = selrow ? *selLine : _lines[i];
+
 		// repaint previously selected lines if needed
 		if (ln._repaint && !Windows::_forceRedraw)
 			_windows->redrawRect(Rect(x0 / GLI_SUBPIX, y,
@@ -1080,7 +1097,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1481,6 +1498,7 @@ void TextBufferWindow::acceptLine(uint32 keycode) {
 		putCharUni('\n');
 	} else {
 		_numChars = _inFence;
+		_lineWidthLen = 0;
 		touch(0);
 	}
 
@@ -1521,9 +1539,11 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lastSeen++;
 	_scrollMax++;
 
-	if (_scrollMax > _scrollBack - 1
-			|| _lastSeen > _scrollBack - 1)
-		scrollResize();
+	// Scrollback is capped, so once it's full the oldest line gets dropped
+	if (_scrollMax > _scrollBack - 1)
+		_scrollMax = _scrollBack - 1;
+	if (_lastSeen > _scrollBack - 1)
+		_lastSeen = _scrollBack - 1;
 
 	if (_lastSeen >= _height)
 		_scrollPos++;
@@ -1540,11 +1560,19 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// Recycle the oldest row as the new current line
+	TextBufferRow &row = _lines.rotate();
+	if (row._lPic)
+		row._lPic->decrement();
+	if (row._rPic)
+		row._rPic->decrement();
+	row._dirty = row._repaint = false;
+
+	_chars = row._chars;
+	_attrs = row._attrs;
+
+	for (int i = 1; i < _height && i < _scrollBack; i++)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1571,36 +1599,9 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 		a->clear();
 
 	_numChars = 0;
+	_lineWidthLen = 0;
 
 	touchScroll();
-
-}
-
-void TextBufferWindow::scrollResize() {
-	int i;
-
-	_lines.clear();
-	_lines.resize(_scrollBack + SCROLLBACK);
-
-	_chars = _lines[0]._chars;
-	_attrs = _lines[0]._attrs;
-
-	for (i = _scrollBack; i < (_scrollBack + SCROLLBACK); i++) {
-		_lines[i]._dirty = false;
-		_lines[i]._repaint = false;
-		_lines[i]._lm = 0;
-		_lines[i]._rm = 0;
-		_lines[i]._lPic = 0;
-		_lines[i]._rPic = 0;
-		_lines[i]._lHyper = 0;
-		_lines[i]._rHyper = 0;
-		_lines[i]._len = 0;
-		_lines[i]._newLine = 0;
-		memset(_lines[i]._chars, ' ', sizeof _lines[i]._chars);
-		memset(_lines[i]._attrs, 0, sizeof _lines[i]._attrs);
-	}
-
-	_scrollBack += SCROLLBACK;
 }
 
 int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numChars, int spw) {
@@ -1622,6 +1623,26 @@ int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, in
 	return w;
 }
 
+int TextBufferWindow::calcLineWidth(int numChars) {
+	int start = _lineWidthLen;
+
+	if (start <= 0 || start > numChars) {
+		_lineWidth = calcWidth(_chars, _attrs, 0, numChars, -1);
+	} else if (start < numChars) {
+		// String widths are additive, kerning included, so only the new characters need
+		// measuring. If they continue the last style run, re-measure from its final
+		// character so the kerning pair across the boundary is picked up
+		if (_attrs[start - 1] == _attrs[start])
+			_lineWidth += calcWidth(_chars, _attrs, start - 1, numChars, -1)
+				- calcWidth(_chars, _attrs, start - 1, start, -1);
+		else
+			_lineWidth += calcWidth(_chars, _attrs, start, numChars, -1);
+	}
+
+	_lineWidthLen = numChars;
+	return _lineWidth;
+}
+
 void TextBufferWindow::getSize(uint *width, uint *height) const {
 	if (width)
 		*width = (_bbox.width() - g_conf->_tMarginX * 2) / _font._cellW;
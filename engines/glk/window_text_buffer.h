@@ -53,7 +53,46 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * Fixed size ring of scrollback rows. Index 0 is always the line currently being
+	 * written to, and higher indexes are progressively older lines
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _head;
+	public:
+		/**
+		 * Constructor
+		 */
+		TextBufferRows() : _head(0) {}
+
+		/**
+		 * Sets the number of rows retained
+		 */
+		void resize(uint count) {
+			_rows.resize(count);
+			_head = 0;
+		}
+
+		/**
+		 * Returns the number of rows retained
+		 */
+		uint size() const { return _rows.size(); }
+
+		TextBufferRow &operator[](int idx) { return _rows[(_head + idx) % _rows.size()]; }
+		const TextBufferRow &operator[](int idx) const { return _rows[(_head + idx) % _rows.size()]; }
+
+		/**
+		 * Scrolls every row up by one, recycling the oldest row as the new row 0.
+		 * The caller is responsible for resetting the returned row
+		 */
+		TextBufferRow &rotate() {
+			_head = (_head + _rows.size() - 1) % _rows.size();
+			return _rows[_head];
+		}
+	};
 private:
 	PropFontInfo &_font;
 private:
@@ -90,8 +129,14 @@ private:
 	void touch(int line);
 
 	void scrollOneLine(bool forced);
-	void scrollResize();
 	int calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numchars, int spw);
+
+	/**
+	 * Returns the width of the first numChars characters of the current line. The width
+	 * is measured incrementally from the previous call, so appending characters one at
+	 * a time doesn't re-measure the whole line each time
+	 */
+	int calcLineWidth(int numChars);
 public:
 	int _width, _height;
 	int _spaced;
@@ -103,6 +148,8 @@ public:
 	int _numChars;        ///< number of chars in last line: lines[0]
 	uint32 *_chars;       ///< alias to lines[0].chars
 	Attributes *_attrs;   ///< alias to lines[0].attrs
+	int _lineWidth;       ///< cached width of the first _lineWidthLen chars of lines[0]
+	int _lineWidthLen;    ///< number of chars covered by _lineWidth, 0 if invalid
 
 	///< adjust margins temporarily for images
 	int _ladjw;
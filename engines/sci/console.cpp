@@ -54,6 +54,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "sci/graphics/celobj32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/paint32.h"
 #include "sci/graphics/palette32.h"
@@ -148,6 +149,8 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
 	registerCmd("visible_plane_items", WRAP_METHOD(Console, cmdVisiblePlaneItemList));
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
+	registerCmd("celobj_cache",       WRAP_METHOD(Console, cmdCelObjCache));
+	registerCmd("cel_bench",          WRAP_METHOD(Console, cmdCelBench));
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -163,6 +166,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -225,6 +229,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("bpe",				WRAP_METHOD(Console, cmdBreakpointFunction));		// alias
 	// VM
 	registerCmd("script_steps",		WRAP_METHOD(Console, cmdScriptSteps));
+	registerCmd("selector_cache",		WRAP_METHOD(Console, cmdSelectorCache));
 	registerCmd("script_objects",   WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("scro",             WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("script_strings",   WRAP_METHOD(Console, cmdScriptStrings));
@@ -365,6 +370,8 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_list / vpl - Shows a list of all the planes in the visible draw list (SCI2+)\n");
 	debugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
+	debugPrintf(" celobj_cache - Shows or resets the cel object cache statistics (SCI2+)\n");
+	debugPrintf(" cel_bench - Measures how long it takes to draw a cel from a view resource (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
 	debugPrintf("\n");
@@ -379,6 +386,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows or resets garbage collector pause times and reclaimed memory\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -424,6 +432,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf("\n");
 	debugPrintf("VM:\n");
 	debugPrintf(" script_steps - Shows the number of executed SCI operations\n");
+	debugPrintf(" selector_cache - Shows or resets the selector lookup cache statistics\n");
 	debugPrintf(" vm_varlist / vmvarlist / vl - Shows the addresses of variables in the VM\n");
 	debugPrintf(" vm_vars / vmvars / vv - Displays or changes variables in the VM\n");
 	debugPrintf(" stack - Lists the specified number of stack elements\n");
@@ -2106,6 +2115,117 @@ bool Console::cmdPlaneItemList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdCelObjCache(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	CelCache *cache = CelObj::getCache();
+	if (!cache) {
+		debugPrintf("This SCI version does not have a cel object cache\n");
+		return true;
+	}
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		cache->resetStats();
+		debugPrintf("Cel object cache statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows the cel object cache statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const uint32 hits = cache->getHits();
+	const uint32 lookups = hits + cache->getMisses();
+	debugPrintf("Entries: %u of %u, size: %u of %u bytes\n", cache->getEntryCount(), cache->getMaxEntryCount(),
+				cache->getSize(), cache->getMaxSize());
+	debugPrintf("Lookups: %u, hits: %u (%u%%), misses: %u, evictions: %u\n", lookups, hits,
+				lookups ? (uint)((uint64)hits * 100 / lookups) : 0, cache->getMisses(), cache->getEvictions());
+
+	const CelScaler &scaler = *CelObj::_scaler;
+	debugPrintf("Scaler lookup tables: %u of %u, hits: %u, misses: %u\n", scaler.getTableCount(),
+				scaler.getMaxTableCount(), scaler.getHits(), scaler.getMisses());
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
+bool Console::cmdCelBench(int argc, const char **argv) {
+	if (argc < 4) {
+		debugPrintf("Measures how long it takes to draw a cel from a view resource\n");
+		debugPrintf("unscaled, mirrored, and scaled down and up, to an offscreen buffer\n");
+		debugPrintf("Usage: %s <resourceId> <loopNr> <celNr> [<iterations>]\n", argv[0]);
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	if (!_engine->_gfxFrameout) {
+		debugPrintf("This SCI version does not draw cel objects\n");
+		return true;
+	}
+
+	const GuiResourceId viewId = atoi(argv[1]);
+	const int16 loopNo = atoi(argv[2]);
+	const int16 celNo = atoi(argv[3]);
+	const int iterations = argc > 4 ? atoi(argv[4]) : 1000;
+
+	if (!_engine->getResMan()->testResource(ResourceId(kResourceTypeView, viewId))) {
+		debugPrintf("View %d not found\n", viewId);
+		return true;
+	}
+	if (loopNo < 0 || loopNo >= CelObjView::getNumLoops(viewId) ||
+		celNo < 0 || celNo >= CelObjView::getNumCels(viewId, loopNo) || iterations <= 0) {
+		debugPrintf("Invalid loop, cel or iteration count\n");
+		return true;
+	}
+
+	CelObjView celObj(viewId, loopNo, celNo);
+	debugPrintf("%s: %ux%u, %s, %s, %s\n", celObj._info.toString().c_str(), celObj._width, celObj._height,
+				celObj._compressionType == kCelCompressionNone ? "uncompressed" : "compressed",
+				celObj._transparent ? "transparent" : "opaque", celObj._remap ? "remap" : "no remap");
+
+	Buffer buffer;
+	buffer.create(celObj._width * 2, celObj._height * 2, Graphics::PixelFormat::createFormatCLUT8());
+
+	static const struct {
+		const char *name;
+		int numerator, denominator;
+		bool mirrorX;
+	} tests[] = {
+		{ "unscaled", 1, 1, false },
+		{ "mirrored", 1, 1, true },
+		{ "scaled 1/2", 1, 2, false },
+		{ "scaled 2/1", 2, 1, false }
+	};
+
+	const Common::Point position(0, 0);
+	for (int i = 0; i < ARRAYSIZE(tests); ++i) {
+		const Ratio ratio(tests[i].numerator, tests[i].denominator);
+		const Common::Rect rect(0, 0, (celObj._width * ratio).toInt(), (celObj._height * ratio).toInt());
+		if (rect.isEmpty()) {
+			continue;
+		}
+
+		// Sets the mirroring flag which drawTo uses
+		celObj.draw(buffer, rect, position, tests[i].mirrorX);
+
+		const uint32 startTime = g_system->getMillis();
+		for (int j = 0; j < iterations; ++j) {
+			celObj.drawTo(buffer, rect, position, ratio, ratio);
+		}
+		const uint64 elapsed = g_system->getMillis() - startTime;
+
+		debugPrintf(" %-10s %4dx%-4d %8u us/draw %6u ns/pixel\n", tests[i].name, rect.width(), rect.height(),
+					(uint)(elapsed * 1000 / iterations),
+					(uint)(elapsed * 1000000 / ((uint64)iterations * rect.width() * rect.height())));
+	}
+
+	buffer.free();
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdVisiblePlaneItemList(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Shows the list of items for a plane\n");
@@ -2829,6 +2949,38 @@ bool Console::cmdGCNormalize(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	GCStatistics &stats = _engine->_gamestate->_gcStats;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		stats.reset();
+		debugPrintf("Garbage collector statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows the garbage collector statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	static const char *const typeNames[] = {
+		"invalid", "script", "clones", "locals", "stack", "obsolete", "lists",
+		"nodes", "hunk", "dynmem", "obsolete", "array", "obsolete", "bitmap"
+	};
+
+	debugPrintf("Collections: %u (%u full), next in %d kernel calls\n", stats.collections,
+				stats.fullCollections, _engine->_gamestate->gcCountDown);
+	debugPrintf("Pause: last %u ms, max %u ms, average %u ms\n", stats.lastPause, stats.maxPause,
+				stats.collections ? stats.totalPause / stats.collections : 0);
+	debugPrintf("Last collection: %u references marked, %u objects (%u bytes) freed\n",
+				stats.lastReachable, stats.lastFreed, stats.lastFreedBytes);
+	debugPrintf("Freed in total:\n");
+	for (int i = 0; i < SEG_TYPE_MAX; i++) {
+		if (stats.freed[i])
+			debugPrintf(" %-8s %8u objects %10u bytes\n", typeNames[i], stats.freed[i], stats.freedBytes[i]);
+	}
+	return true;
+}
+
 bool Console::cmdVMVarlist(int argc, const char **argv) {
 	EngineState *s = _engine->_gamestate;
 	const char *varnames[] = {"global", "local", "temp", "param"};
@@ -3258,6 +3410,27 @@ bool Console::cmdScriptSteps(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdSelectorCache(int argc, const char **argv) {
+	SelectorLookupCache &cache = _engine->_gamestate->_segMan->getSelectorLookupCache();
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		cache.resetStats();
+		debugPrintf("Selector lookup cache statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows the selector lookup cache statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const uint32 hits = cache.getHits();
+	const uint32 lookups = hits + cache.getMisses();
+	debugPrintf("Selector lookups: %u, hits: %u (%u%%), misses: %u\n", lookups, hits,
+				lookups ? (uint)((uint64)hits * 100 / lookups) : 0, cache.getMisses());
+	debugPrintf("Invalidations: %u\n", cache.getInvalidations());
+	return true;
+}
+
 bool Console::cmdScriptObjects(int argc, const char **argv) {
 	int curScriptNr = -1;
 
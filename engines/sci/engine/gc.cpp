@@ -22,6 +22,8 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
+#include "sci/engine/script.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -99,11 +101,9 @@ static void processWorkList(SegManager *segMan, WorklistManager &wm, const Commo
 	}
 }
 
-AddrSet *findAllActiveReferences(EngineState *s) {
+static void markActiveReferences(EngineState *s, WorklistManager &wm) {
 	assert(!s->_executionStack.empty());
 
-	WorklistManager wm;
-
 	// Initialize registers
 	wm.push(s->r_acc);
 	wm.push(s->r_prev);
@@ -175,12 +175,81 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 	if (g_sci->_gfxPorts)
 		g_sci->_gfxPorts->processEngineHunkList(wm);
+}
 
+AddrSet *findAllActiveReferences(EngineState *s) {
+	WorklistManager wm;
+	markActiveReferences(s, wm);
 	return normalizeAddresses(s->_segMan, wm._map);
 }
 
-void run_gc(EngineState *s) {
+/**
+ * Adds the canonic addresses of all marked references to the marked set
+ * itself, instead of building a separate normalised set like
+ * normalizeAddresses() does. Every deallocatable address is its own canonic
+ * address, so the extra non-canonic entries do not change the outcome of the
+ * sweep.
+ */
+static void addCanonicAddresses(SegManager *segMan, AddrSet &map) {
+	Common::Array<reg_t> canonic;
+
+	for (AddrSet::const_iterator i = map.begin(); i != map.end(); ++i) {
+		const reg_t reg = i->_key;
+		SegmentObj *mobj = segMan->getSegmentObj(reg.getSegment());
+
+		if (mobj) {
+			const reg_t canonicReg = mobj->findCanonicAddress(segMan, reg);
+			if (canonicReg != reg)
+				canonic.push_back(canonicReg);
+		}
+	}
+
+	for (Common::Array<reg_t>::const_iterator it = canonic.begin(); it != canonic.end(); ++it)
+		map.setVal(*it, true);
+}
+
+/**
+ * Estimates the number of bytes which will be released by freeing the object
+ * at the given address.
+ */
+static uint32 estimateObjectSize(SegmentObj *mobj, reg_t addr) {
+	switch (mobj->getType()) {
+	case SEG_TYPE_SCRIPT:
+		return static_cast<Script *>(mobj)->getBufSize();
+	case SEG_TYPE_CLONES:
+		return sizeof(Clone);
+	case SEG_TYPE_LISTS:
+		return sizeof(List);
+	case SEG_TYPE_NODES:
+		return sizeof(Node);
+	case SEG_TYPE_HUNK:
+		return sizeof(Hunk) + static_cast<HunkTable *>(mobj)->at(addr.getOffset()).size;
+	case SEG_TYPE_DYNMEM:
+		return static_cast<DynMem *>(mobj)->_size;
+#ifdef ENABLE_SCI32
+	case SEG_TYPE_ARRAY:
+		return sizeof(SciArray) + static_cast<ArrayTable *>(mobj)->at(addr.getOffset()).byteSize();
+	case SEG_TYPE_BITMAP:
+		return sizeof(SciBitmap) + static_cast<BitmapTable *>(mobj)->at(addr.getOffset()).getRawSize();
+#endif
+	default:
+		return 0;
+	}
+}
+
+void run_gc(EngineState *s, bool fullCollection) {
 	SegManager *segMan = s->_segMan;
+	GCStatistics &stats = s->_gcStats;
+	const uint32 startTime = g_system->getMillis();
+
+	// Clones tend to live as long as the room which created them, so most
+	// periodic collections leave them alone and only look at the short-lived
+	// segments. Marking is always complete, so skipping a sweep only delays
+	// the freeing of unreachable clones.
+	if (!fullCollection && ++s->gcPartialCollections >= GC_FULL_INTERVAL)
+		fullCollection = true;
+	if (fullCollection)
+		s->gcPartialCollections = 0;
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -191,18 +260,43 @@ void run_gc(EngineState *s) {
 	memset(segcount, 0, sizeof(segcount));
 #endif
 
+	const Common::Array<SegmentObj *> &heap = segMan->getSegments();
+
 	// Compute the set of all segments references currently in use.
-	AddrSet *activeRefs = findAllActiveReferences(s);
+	WorklistManager wm;
+	markActiveReferences(s, wm);
+
+	// A partial collection keeps every clone, reachable or not, so whatever
+	// those clones refer to has to be kept as well. Otherwise a surviving
+	// clone could be left pointing at a freed list or array, and be written
+	// that way into a saved game.
+	if (!fullCollection) {
+		for (uint seg = 1; seg < heap.size(); seg++) {
+			if (heap[seg] && heap[seg]->getType() == SEG_TYPE_CLONES)
+				wm.pushArray(heap[seg]->listAllDeallocatable(seg));
+		}
+		processWorkList(segMan, wm, heap);
+	}
+
+	addCanonicAddresses(segMan, wm._map);
+	const AddrSet &activeRefs = wm._map;
+
+	uint32 freedCount = 0;
+	uint32 freedBytes = 0;
 
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
-	const Common::Array<SegmentObj *> &heap = segMan->getSegments();
 	for (uint seg = 1; seg < heap.size(); seg++) {
 		SegmentObj *mobj = heap[seg];
 
 		if (mobj != NULL) {
-#ifdef GC_DEBUG_CODE
 			const SegmentType type = mobj->getType();
+			if (!fullCollection && type == SEG_TYPE_CLONES)
+				continue;
+			// Unreferenced scripts are only unloaded once the game asked for it
+			if (type == SEG_TYPE_SCRIPT && !static_cast<Script *>(mobj)->isMarkedAsDeleted())
+				continue;
+#ifdef GC_DEBUG_CODE
 			segnames[type] = segmentTypeNames[type];
 #endif
 
@@ -211,8 +305,13 @@ void run_gc(EngineState *s) {
 			const Common::Array<reg_t> tmp = mobj->listAllDeallocatable(seg);
 			for (Common::Array<reg_t>::const_iterator it = tmp.begin(); it != tmp.end(); ++it) {
 				const reg_t addr = *it;
-				if (!activeRefs->contains(addr)) {
+				if (!activeRefs.contains(addr)) {
 					// Not found -> we can free it
+					const uint32 size = estimateObjectSize(mobj, addr);
+					++freedCount;
+					freedBytes += size;
+					++stats.freed[type];
+					stats.freedBytes[type] += size;
 					mobj->freeAtAddress(segMan, addr);
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
@@ -224,7 +323,17 @@ void run_gc(EngineState *s) {
 		}
 	}
 
-	delete activeRefs;
+	const uint32 pause = g_system->getMillis() - startTime;
+	++stats.collections;
+	if (fullCollection)
+		++stats.fullCollections;
+	stats.lastPause = pause;
+	stats.maxPause = MAX(stats.maxPause, pause);
+	stats.totalPause += pause;
+	stats.lastReachable = activeRefs.size();
+	stats.lastFreed = freedCount;
+	stats.lastFreedBytes = freedBytes;
+	debugC(kDebugLevelGC, "[GC] Freed %u objects (%u bytes) in %u ms", freedCount, freedBytes, pause);
 
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
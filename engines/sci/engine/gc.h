@@ -52,8 +52,10 @@ AddrSet *findAllActiveReferences(EngineState *s);
 /**
  * Runs garbage collection on the current system state
  * @param s The state in which we should gc
+ * @param fullCollection If false, the long-lived clone table is only swept
+ *                       on every GC_FULL_INTERVAL-th collection
  */
-void run_gc(EngineState *s);
+void run_gc(EngineState *s, bool fullCollection = true);
 
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
@@ -933,6 +933,9 @@ void script_adjust_opcode_formats() {
 
 	g_sci->_opcode_formats = new opcode_format[128][4];
 	memcpy(g_sci->_opcode_formats, g_base_opcode_formats, 128*4*sizeof(opcode_format));
+	// detectLofsType() below decodes script bytecode, so it needs layouts for
+	// the base formats. They are rebuilt once the adjustments are known.
+	initPMachineInstructionLayouts();
 
 	if (g_sci->_features->detectLofsType() != SCI_VERSION_0_EARLY) {
 		g_sci->_opcode_formats[op_lofsa][0] = Script_Offset;
@@ -956,6 +959,10 @@ void script_adjust_opcode_formats() {
 		g_sci->_opcode_formats[op_superP][0] = Script_None;
 	}
 #endif
+
+	// Pick up the version specific formats. The layouts are recomputed from
+	// scratch, so calling this again is safe.
+	initPMachineInstructionLayouts();
 }
 
 } // End of namespace Sci
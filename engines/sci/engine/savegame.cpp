@@ -337,6 +337,9 @@ void SegManager::saveLoadWithSerializer(Common::Serializer &s) {
 #endif
 			}
 		}
+
+		// Drop any lookups made while the objects were being set up
+		_selectorLookupCache.invalidate();
 	}
 }
 
@@ -312,6 +312,53 @@ void invokeSelector(EngineState *s, reg_t object, int selectorId,
 	run_vm(s); // Start a new vm
 }
 
+SelectorLookupCache::SelectorLookupCache() {
+	invalidate();
+	resetStats();
+}
+
+void SelectorLookupCache::invalidate() {
+	for (uint i = 0; i < kSets; i++) {
+		_entries[i][0].selectorId = -1;
+		_entries[i][1].selectorId = -1;
+	}
+	_invalidations++;
+}
+
+uint SelectorLookupCache::getSet(reg_t pos, Selector selectorId) {
+	const uint hash = (pos.getSegment() * 31 + pos.getOffset()) ^ (selectorId * 2654435761U);
+	return (hash ^ (hash >> 16)) & (kSets - 1);
+}
+
+bool SelectorLookupCache::lookup(reg_t pos, reg_t superClass, bool isClass, Selector selectorId, SelectorType &type, int &varIndex, reg_t &func) {
+	Entry *set = _entries[getSet(pos, selectorId)];
+	for (int way = 0; way < 2; way++) {
+		const Entry &entry = set[way];
+		if (entry.selectorId == selectorId && entry.pos == pos && entry.superClass == superClass && entry.isClass == isClass) {
+			type = entry.type;
+			varIndex = entry.varIndex;
+			func = entry.func;
+			_hits++;
+			return true;
+		}
+	}
+
+	_misses++;
+	return false;
+}
+
+void SelectorLookupCache::store(reg_t pos, reg_t superClass, bool isClass, Selector selectorId, SelectorType type, int varIndex, reg_t func) {
+	Entry *set = _entries[getSet(pos, selectorId)];
+	set[1] = set[0];
+	set[0].pos = pos;
+	set[0].superClass = superClass;
+	set[0].isClass = isClass;
+	set[0].selectorId = selectorId;
+	set[0].type = type;
+	set[0].varIndex = varIndex;
+	set[0].func = func;
+}
+
 SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
 	const Object *obj = segMan->getObject(obj_location);
 	int index;
@@ -327,32 +374,47 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x, %s", PRINT_REG(obj_location), origin.toString().c_str());
 	}
 
-	index = obj->locateVarSelector(segMan, selectorId);
+	SelectorLookupCache &cache = segMan->getSelectorLookupCache();
+	const reg_t pos = obj->getPos();
+	const reg_t superClass = obj->getSuperClassSelector();
+	const bool isClass = obj->isClass();
+	SelectorType type;
+	reg_t func = NULL_REG;
+
+	if (!cache.lookup(pos, superClass, isClass, selectorId, type, index, func)) {
+		index = obj->locateVarSelector(segMan, selectorId);
+
+		if (index >= 0) {
+			// Found it as a variable
+			type = kSelectorVariable;
+		} else {
+			// Check if it's a method, with recursive lookup in superclasses
+			type = kSelectorNone;
+			for (const Object *cur = obj; cur; cur = segMan->getObject(cur->getSuperClassSelector())) {
+				const int funcIndex = cur->funcSelectorPosition(selectorId);
+				if (funcIndex >= 0) {
+					func = cur->getFunction(funcIndex);
+					type = kSelectorMethod;
+					break;
+				}
+			}
+		}
 
-	if (index >= 0) {
-		// Found it as a variable
+		cache.store(pos, superClass, isClass, selectorId, type, index, func);
+	}
+
+	if (type == kSelectorVariable) {
 		if (varp) {
 			varp->obj = obj_location;
 			varp->varindex = index;
 		}
-		return kSelectorVariable;
-	} else {
-		// Check if it's a method, with recursive lookup in superclasses
-		while (obj) {
-			index = obj->funcSelectorPosition(selectorId);
-			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
-				return kSelectorMethod;
-			} else {
-				obj = segMan->getObject(obj->getSuperClassSelector());
-			}
-		}
-
-		return kSelectorNone;
+	} else if (type == kSelectorMethod) {
+		if (fptr)
+			*fptr = func;
 	}
 
+	return type;
+
 
 //	return _lookupSelector_function(segMan, obj, selectorId, fptr);
 }
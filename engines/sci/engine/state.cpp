@@ -82,6 +82,7 @@ void EngineState::reset(bool isRestoring) {
 		_memorySegmentSize = 0;
 		_fileHandles.resize(5);
 		abortScriptProcessing = kAbortNone;
+		_gcStats.reset();
 	} else {
 		g_sci->_guestAdditions->reset();
 	}
@@ -100,6 +101,7 @@ void EngineState::reset(bool isRestoring) {
 	lastWaitTime = 0;
 
 	gcCountDown = 0;
+	gcPartialCollections = 0;
 
 #ifdef ENABLE_SCI32
 	_eventCounter = 0;
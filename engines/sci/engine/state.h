@@ -98,6 +98,26 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Statistics about the garbage collector, shown by the "gc_stats" console
+ * command. Reclaimed byte counts are estimates of the payload of the freed
+ * objects and do not include the bookkeeping of their segments.
+ */
+struct GCStatistics {
+	uint32 collections;     /**< Number of gcs performed */
+	uint32 fullCollections; /**< Number of gcs which also swept the clone table */
+	uint32 lastPause;       /**< Duration of the last gc, in ms */
+	uint32 maxPause;        /**< Duration of the longest gc, in ms */
+	uint32 totalPause;      /**< Total time spent in gcs, in ms */
+	uint32 lastReachable;   /**< Number of references marked by the last gc */
+	uint32 lastFreed;       /**< Number of objects freed by the last gc */
+	uint32 lastFreedBytes;  /**< Estimated bytes reclaimed by the last gc */
+	uint32 freed[SEG_TYPE_MAX];      /**< Total number of objects freed, per segment type */
+	uint32 freedBytes[SEG_TYPE_MAX]; /**< Total estimated bytes reclaimed, per segment type */
+
+	void reset() { memset(this, 0, sizeof(*this)); }
+};
+
 struct EngineState : public Common::Serializable {
 public:
 	EngineState(SegManager *segMan);
@@ -190,6 +210,8 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	uint gcPartialCollections; /**< Number of periodic gcs since the clone table was last swept */
+	GCStatistics _gcStats;
 
 	MessageState *_msgState;
 
@@ -456,85 +456,114 @@ static void callKernelFunc(EngineState *s, int kernelCallNr, int argc) {
 		s->_executionStack.pop_back();
 }
 
+namespace {
+
+enum OperandType {
+	kOperandNone = 0,
+	kOperandByte,
+	kOperandSByte,
+	kOperandWord
+};
+
+/**
+ * Operand layout of an extended opcode, resolved from the opcode formats
+ * and the operand size bit of the extended opcode.
+ */
+struct InstructionLayout {
+	bool invalid;
+	bool fileName; ///< followed by a null-terminated file name (op_file)
+	byte operandCount;
+	byte operands[3];
+};
+
+InstructionLayout s_instructionLayouts[256];
+
+OperandType getOperandType(opcode_format format, bool byteOperands) {
+	switch (format) {
+	case Script_Byte:
+		return kOperandByte;
+	case Script_SByte:
+		return kOperandSByte;
+	case Script_Word:
+	case Script_SWord:
+		return kOperandWord;
+	case Script_Variable:
+	case Script_Property:
+	case Script_Local:
+	case Script_Temp:
+	case Script_Global:
+	case Script_Param:
+	case Script_Offset:
+		return byteOperands ? kOperandByte : kOperandWord;
+	case Script_SVariable:
+	case Script_SRelative:
+		return byteOperands ? kOperandSByte : kOperandWord;
+	default:
+		return kOperandNone;
+	}
+}
+
+} // End of anonymous namespace
+
+void initPMachineInstructionLayouts() {
+	for (int extOpcode = 0; extOpcode < 256; extOpcode++) {
+		InstructionLayout &layout = s_instructionLayouts[extOpcode];
+		const byte opcode = extOpcode >> 1;
+		const opcode_format *formats = g_sci->_opcode_formats[opcode];
+
+		layout.invalid = false;
+		layout.operandCount = 0;
+		for (int i = 0; formats[i]; ++i) {
+			assert(i < 3);
+			if (formats[i] == Script_Invalid) {
+				layout.invalid = true;
+				break;
+			}
+			layout.operands[layout.operandCount++] = getOperandType(formats[i], extOpcode & 1);
+		}
+
+		// Special handling of the op_line opcode
+		// Compensate for a bug in non-Sierra compilers, which seem to generate
+		// pushSelf instructions with the low bit set. This makes the following
+		// heuristic fail and leads to endless loops and crashes. Our
+		// interpretation of this seems correct, as other SCI tools, like for
+		// example SCI Viewer, have issues with these scripts (e.g. script 999
+		// in Circus Quest). Fixes bug #3038686.
+		// If the low bit is set, this is the debug opcode op_file, which is
+		// followed by a null-terminated string (file name).
+		layout.fileName = (opcode == op_pushSelf && (extOpcode & 1) && g_sci->getGameId() != GID_FANMADE);
+	}
+}
+
 int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4]) {
 	uint offset = 0;
 	extOpcode = src[offset++]; // Get "extended" opcode (lower bit has special meaning)
-	const byte opcode = extOpcode >> 1;	// get the actual opcode
+	const InstructionLayout &layout = s_instructionLayouts[extOpcode];
 
-	memset(opparams, 0, 4*sizeof(int16));
+	if (layout.invalid)
+		error("opcode %02x: Invalid", extOpcode);
 
-	for (int i = 0; g_sci->_opcode_formats[opcode][i]; ++i) {
-		//debugN("Opcode: 0x%x, Opnumber: 0x%x, temp: %d\n", opcode, opcode, temp);
-		assert(i < 3);
-		switch (g_sci->_opcode_formats[opcode][i]) {
+	opparams[0] = opparams[1] = opparams[2] = opparams[3] = 0;
 
-		case Script_Byte:
+	for (uint i = 0; i < layout.operandCount; ++i) {
+		switch (layout.operands[i]) {
+		case kOperandByte:
 			opparams[i] = src[offset++];
 			break;
-		case Script_SByte:
+		case kOperandSByte:
 			opparams[i] = (int8)src[offset++];
 			break;
-
-		case Script_Word:
+		case kOperandWord:
 			opparams[i] = READ_SCI11ENDIAN_UINT16(src + offset);
 			offset += 2;
 			break;
-		case Script_SWord:
-			opparams[i] = (int16)READ_SCI11ENDIAN_UINT16(src + offset);
-			offset += 2;
-			break;
-
-		case Script_Variable:
-		case Script_Property:
-
-		case Script_Local:
-		case Script_Temp:
-		case Script_Global:
-		case Script_Param:
-
-		case Script_Offset:
-			if (extOpcode & 1) {
-				opparams[i] = src[offset++];
-			} else {
-				opparams[i] = READ_SCI11ENDIAN_UINT16(src + offset);
-				offset += 2;
-			}
-			break;
-
-		case Script_SVariable:
-		case Script_SRelative:
-			if (extOpcode & 1) {
-				opparams[i] = (int8)src[offset++];
-			} else {
-				opparams[i] = (int16)READ_SCI11ENDIAN_UINT16(src + offset);
-				offset += 2;
-			}
-			break;
-
-		case Script_None:
-		case Script_End:
-			break;
-
-		case Script_Invalid:
 		default:
-			error("opcode %02x: Invalid", extOpcode);
+			break;
 		}
 	}
 
-	// Special handling of the op_line opcode
-	if (opcode == op_pushSelf) {
-		// Compensate for a bug in non-Sierra compilers, which seem to generate
-		// pushSelf instructions with the low bit set. This makes the following
-		// heuristic fail and leads to endless loops and crashes. Our
-		// interpretation of this seems correct, as other SCI tools, like for
-		// example SCI Viewer, have issues with these scripts (e.g. script 999
-		// in Circus Quest). Fixes bug #3038686.
-		if (!(extOpcode & 1) || g_sci->getGameId() == GID_FANMADE) {
-			// op_pushSelf: no adjustment necessary
-		} else {
-			// Debug opcode op_file, skip null-terminated string (file name)
-			while (src[offset++]) {}
-		}
+	if (layout.fileName) {
+		while (src[offset++]) {}
 	}
 
 	return offset;
@@ -883,7 +912,7 @@ void run_vm(EngineState *s) {
 			// Run the garbage collector, if needed
 			if (s->gcCountDown-- <= 0) {
 				s->gcCountDown = s->scriptGCInterval;
-				run_gc(s);
+				run_gc(s, false);
 			}
 
 			// Call kernel function
@@ -71,6 +71,66 @@ struct ObjVarRef {
 	reg_t* getPointer(SegManager *segMan) const;
 };
 
+/**
+ * Caches the results of lookupSelector(). Sends to the same kind of object
+ * repeat the same lookups over and over, so results are remembered keyed on
+ * the base position of the object (which clones share with their original),
+ * its superclass, its class flag and the selector. This avoids the variable selector scan and
+ * the walk up the superclass chain on every send.
+ *
+ * Method addresses and superclass chains depend on the loaded scripts, so the
+ * cache has to be invalidated whenever a script is loaded or unloaded, and
+ * when a game is restored.
+ */
+class SelectorLookupCache {
+public:
+	SelectorLookupCache();
+
+	/** Drops all cached lookups. */
+	void invalidate();
+
+	/**
+	 * Looks up a cached result.
+	 * @return false if the lookup is not cached
+	 */
+	bool lookup(reg_t pos, reg_t superClass, bool isClass, Selector selectorId, SelectorType &type, int &varIndex, reg_t &func);
+
+	/** Stores the result of a lookup. */
+	void store(reg_t pos, reg_t superClass, bool isClass, Selector selectorId, SelectorType type, int varIndex, reg_t func);
+
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getInvalidations() const { return _invalidations; }
+	void resetStats() { _hits = _misses = _invalidations = 0; }
+
+private:
+	enum {
+		kSets = 512 ///< Must be a power of two
+	};
+
+	struct Entry {
+		reg_t pos;
+		reg_t superClass;
+		bool isClass;
+		Selector selectorId; ///< -1 for an empty entry
+		SelectorType type;
+		int varIndex;
+		reg_t func;
+	};
+
+	/**
+	 * Two entries per set, the most recently stored one first, so that call
+	 * sites alternating between two kinds of objects still hit the cache.
+	 */
+	Entry _entries[kSets][2];
+
+	uint32 _hits;
+	uint32 _misses;
+	uint32 _invalidations;
+
+	static uint getSet(reg_t pos, Selector selectorId);
+};
+
 enum ExecStackType {
 	EXEC_STACK_TYPE_CALL = 0,
 	EXEC_STACK_TYPE_KERNEL = 1,
@@ -188,6 +248,15 @@ enum {
 	GC_INTERVAL = 0x8000
 };
 
+/**
+ * Number of periodic gcs in between sweeps of the clone table. The other
+ * sweeps only look at short-lived lists, nodes, hunks, arrays and dynamic
+ * memory, which make up most of the garbage between rooms.
+ */
+enum {
+	GC_FULL_INTERVAL = 8
+};
+
 enum SciOpcodes {
 	op_bnot     = 0x00,	// 000
 	op_add      = 0x01,	// 001
@@ -417,6 +486,13 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
  */
 int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4]);
 
+/**
+ * Resolves the operand layout of every extended opcode from the current
+ * opcode formats, for use by readPMachineInstruction(). Must be called
+ * whenever the opcode formats change.
+ */
+void initPMachineInstructionLayouts();
+
 /**
  * Finds the script-absolute offset of a relative object offset.
  *
@@ -40,27 +40,52 @@ namespace Sci {
 
 Common::ScopedPtr<CelScaler> CelObj::_scaler;
 
-void CelScaler::activateScaleTables(const Ratio &scaleX, const Ratio &scaleY) {
-	for (int i = 0; i < ARRAYSIZE(_scaleTables); ++i) {
-		if (_scaleTables[i].scaleX == scaleX && _scaleTables[i].scaleY == scaleY) {
-			_activeIndex = i;
-			return;
-		}
+CelScaler::CelScaler(const uint32 maxSize) :
+	_maxLookupTables(MAX<uint>(maxSize / (kCelScalerTableSize * sizeof(int)), 2)),
+	_clock(0),
+	_hits(0),
+	_misses(0) {
+	_activeTable.valuesX = _activeTable.valuesY = getLookupTable(Ratio(), nullptr);
+}
+
+CelScaler::~CelScaler() {
+	for (uint i = 0; i < _lookupTables.size(); ++i) {
+		delete[] _lookupTables[i].values;
 	}
+}
 
-	const int i = 1 - _activeIndex;
-	_activeIndex = i;
-	CelScalerTable &table = _scaleTables[i];
+const int *CelScaler::getLookupTable(const Ratio &ratio, const int *keep) {
+	++_clock;
 
-	if (table.scaleX != scaleX) {
-		buildLookupTable(table.valuesX, scaleX, kCelScalerTableSize);
-		table.scaleX = scaleX;
+	for (uint i = 0; i < _lookupTables.size(); ++i) {
+		if (_lookupTables[i].ratio == ratio) {
+			++_hits;
+			_lookupTables[i].lastUse = _clock;
+			return _lookupTables[i].values;
+		}
 	}
 
-	if (table.scaleY != scaleY) {
-		buildLookupTable(table.valuesY, scaleY, kCelScalerTableSize);
-		table.scaleY = scaleY;
+	++_misses;
+
+	LookupTable *table;
+	if (_lookupTables.size() < _maxLookupTables) {
+		_lookupTables.push_back(LookupTable());
+		table = &_lookupTables.back();
+		table->values = new int[kCelScalerTableSize];
+	} else {
+		table = nullptr;
+		for (uint i = 0; i < _lookupTables.size(); ++i) {
+			LookupTable &candidate = _lookupTables[i];
+			if (candidate.values != keep && (!table || candidate.lastUse < table->lastUse)) {
+				table = &candidate;
+			}
+		}
 	}
+
+	table->ratio = ratio;
+	table->lastUse = _clock;
+	buildLookupTable(table->values, ratio, kCelScalerTableSize);
+	return table->values;
 }
 
 void CelScaler::buildLookupTable(int *table, const Ratio &ratio, const int size) {
@@ -78,20 +103,40 @@ void CelScaler::buildLookupTable(int *table, const Ratio &ratio, const int size)
 }
 
 const CelScalerTable &CelScaler::getScalerTable(const Ratio &scaleX, const Ratio &scaleY) {
-	activateScaleTables(scaleX, scaleY);
-	return _scaleTables[_activeIndex];
+	if (_activeTable.scaleX != scaleX || _activeTable.scaleY != scaleY) {
+		_activeTable.valuesX = getLookupTable(scaleX, nullptr);
+		_activeTable.scaleX = scaleX;
+		_activeTable.valuesY = getLookupTable(scaleY, _activeTable.valuesX);
+		_activeTable.scaleY = scaleY;
+	}
+	return _activeTable;
 }
 
 #pragma mark -
 #pragma mark CelObj
 bool CelObj::_drawBlackLines = false;
+bool CelObj::_useLarryScale = false;
 
 void CelObj::init() {
 	CelObj::deinit();
 	_drawBlackLines = false;
-	_nextCacheId = 1;
-	_scaler.reset(new CelScaler());
-	_cache.reset(new CelCache(100));
+	_useLarryScale = Common::checkGameGUIOption(GAMEOPTION_LARRYSCALE, ConfMan.get("guioptions")) && ConfMan.getBool("enable_larryscale");
+	// Each lookup table takes 16KiB, so this keeps the tables for a few
+	// dozen scaling ratios around
+	uint32 scalerCacheSize = 512 * 1024;
+	if (ConfMan.hasKey("celobj_scaler_cache_size"))
+		scalerCacheSize = MAX(ConfMan.getInt("celobj_scaler_cache_size"), 0) * 1024;
+	_scaler.reset(new CelScaler(scalerCacheSize));
+
+	// By default, the cache holds as many cels as the 100 entry cache of
+	// SSCI did. The size limit, in KiB, only matters when it is set lower.
+	uint cacheEntries = 100;
+	if (ConfMan.hasKey("celobj_cache_entries"))
+		cacheEntries = MAX(ConfMan.getInt("celobj_cache_entries"), 1);
+	uint32 cacheSize = 256 * 1024;
+	if (ConfMan.hasKey("celobj_cache_size"))
+		cacheSize = MAX(ConfMan.getInt("celobj_cache_size"), 0) * 1024;
+	_cache.reset(new CelCache(cacheEntries, cacheSize));
 }
 
 void CelObj::deinit() {
@@ -203,8 +248,7 @@ struct SCALER_Scale {
 
 		const CelScalerTable &table = CelObj::_scaler->getScalerTable(scaleX, scaleY);
 
-		const bool useLarryScale = Common::checkGameGUIOption(GAMEOPTION_LARRYSCALE, ConfMan.get("guioptions")) && ConfMan.getBool("enable_larryscale");
-		if (useLarryScale) {
+		if (CelObj::_useLarryScale) {
 			// LarryScale is an alternative, high-quality cel scaler implemented
 			// for ScummVM. Due to the nature of smooth upscaling, it does *not*
 			// respect the global scaling pattern. Instead, it simply scales the
@@ -664,45 +708,98 @@ void CelObj::submitPalette() const {
 #pragma mark -
 #pragma mark CelObj - Caching
 
-int CelObj::_nextCacheId = 1;
-Common::ScopedPtr<CelCache> CelObj::_cache;
+CelCache::CelCache(const uint maxEntries, const uint32 maxSize) :
+	_head(nullptr),
+	_tail(nullptr),
+	_maxEntries(maxEntries),
+	_size(0),
+	_maxSize(maxSize),
+	_hits(0),
+	_misses(0),
+	_evictions(0) {}
 
-int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
-	*nextInsertIndex = -1;
-	int oldestId = _nextCacheId + 1;
-	int oldestIndex = 0;
+CelCache::~CelCache() {
+	while (_head) {
+		eraseEntry(_head);
+	}
+}
 
-	for (int i = 0, len = _cache->size(); i < len; ++i) {
-		CelCacheEntry &entry = (*_cache)[i];
+void CelCache::linkEntry(Entry *entry) {
+	entry->prev = nullptr;
+	entry->next = _head;
+	if (_head) {
+		_head->prev = entry;
+	} else {
+		_tail = entry;
+	}
+	_head = entry;
+}
 
-		if (entry.celObj == nullptr) {
-			if (*nextInsertIndex == -1) {
-				*nextInsertIndex = i;
-			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
-		} else if (oldestId > entry.id) {
-			oldestId = entry.id;
-			oldestIndex = i;
-		}
+void CelCache::unlinkEntry(Entry *entry) {
+	if (entry->prev) {
+		entry->prev->next = entry->next;
+	} else {
+		_head = entry->next;
+	}
+	if (entry->next) {
+		entry->next->prev = entry->prev;
+	} else {
+		_tail = entry->prev;
 	}
+}
+
+void CelCache::eraseEntry(Entry *entry) {
+	unlinkEntry(entry);
+	_entries.erase(entry->celObj->_info);
+	_size -= entry->size;
+	delete entry->celObj;
+	delete entry;
+}
 
-	if (*nextInsertIndex == -1) {
-		*nextInsertIndex = oldestIndex;
+const CelObj *CelCache::find(const CelInfo32 &info) {
+	EntryMap::const_iterator it = _entries.find(info);
+	if (it == _entries.end()) {
+		++_misses;
+		return nullptr;
 	}
 
-	return -1;
+	++_hits;
+	Entry *entry = it->_value;
+	if (entry != _head) {
+		unlinkEntry(entry);
+		linkEntry(entry);
+	}
+	return entry->celObj;
 }
 
-void CelObj::putCopyInCache(const int cacheIndex) const {
-	if (cacheIndex == -1) {
-		error("Invalid cache index");
+void CelCache::put(const CelObj &celObj) {
+	EntryMap::iterator it = _entries.find(celObj._info);
+	if (it != _entries.end()) {
+		eraseEntry(it->_value);
+	}
+
+	Entry *entry = new Entry;
+	entry->celObj = celObj.duplicate();
+	entry->size = sizeof(Entry) + celObj.getObjectSize();
+	linkEntry(entry);
+	_entries.setVal(celObj._info, entry);
+	_size += entry->size;
+
+	// The new entry is always kept, even if it exceeds the budget on its own
+	while ((_entries.size() > _maxEntries || _size > _maxSize) && _tail != entry) {
+		eraseEntry(_tail);
+		++_evictions;
 	}
+}
+
+Common::ScopedPtr<CelCache> CelObj::_cache;
 
-	CelCacheEntry &entry = (*_cache)[cacheIndex];
-	entry.celObj.reset(duplicate());
-	entry.id = ++_nextCacheId;
+const CelObj *CelObj::searchCache(const CelInfo32 &celInfo) const {
+	return _cache->find(celInfo);
+}
+
+void CelObj::putCopyInCache() const {
+	_cache->put(*this);
 }
 
 #pragma mark -
@@ -766,6 +863,53 @@ void CelObj::render(Buffer &target, const Common::Rect &targetRect, const Common
 	}
 }
 
+/**
+ * Copies a row of pixels to the target, leaving out pixels of the skip color.
+ * Pixels are tested four at a time, so that runs of opaque or transparent
+ * pixels are copied or skipped without comparing every single pixel.
+ */
+static inline void drawRowSkipColor(byte *target, const byte *source, int16 width, const uint8 skipColor) {
+	const uint32 skipPixels = skipColor * 0x01010101;
+	for (; width >= 4; width -= 4, source += 4, target += 4) {
+		const uint32 pixels = READ_UINT32(source);
+		const uint32 diff = pixels ^ skipPixels;
+		if (!((diff - 0x01010101) & ~diff & 0x80808080)) {
+			// None of the pixels has the skip color
+			WRITE_UINT32(target, pixels);
+		} else if (diff) {
+			for (int i = 0; i < 4; ++i) {
+				if (source[i] != skipColor) {
+					target[i] = source[i];
+				}
+			}
+		}
+	}
+
+	for (; width > 0; --width, ++source, ++target) {
+		if (*source != skipColor) {
+			*target = *source;
+		}
+	}
+}
+
+template<typename READER, bool SKIP>
+void CelObj::renderUnscaledNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
+	const int16 sourceX = targetRect.left - scaledPosition.x;
+	const int16 targetWidth = targetRect.width();
+	READER reader(*this, sourceX + targetWidth);
+
+	byte *targetPixel = (byte *)target.getPixels() + target.w * targetRect.top + targetRect.left;
+	for (int16 y = targetRect.top; y < targetRect.bottom; ++y) {
+		const byte *sourcePixel = reader.getRow(y - scaledPosition.y) + sourceX;
+		if (SKIP) {
+			drawRowSkipColor(targetPixel, sourcePixel, targetWidth, _skipColor);
+		} else {
+			memcpy(targetPixel, sourcePixel, targetWidth);
+		}
+		targetPixel += target.w;
+	}
+}
+
 void CelObj::drawHzFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
 	render<MAPPER_NoMap, SCALER_NoScale<true, READER_Compressed> >(target, targetRect, scaledPosition);
 }
@@ -831,7 +975,7 @@ void CelObj::scaleDrawUncompMap(Buffer &target, const Ratio &scaleX, const Ratio
 }
 
 void CelObj::drawNoFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
-	render<MAPPER_NoMD, SCALER_NoScale<false, READER_Compressed> >(target, targetRect, scaledPosition);
+	renderUnscaledNoMD<READER_Compressed, true>(target, targetRect, scaledPosition);
 }
 
 void CelObj::drawHzFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
@@ -839,11 +983,11 @@ void CelObj::drawHzFlipNoMD(Buffer &target, const Common::Rect &targetRect, cons
 }
 
 void CelObj::drawUncompNoFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
-	render<MAPPER_NoMD, SCALER_NoScale<false, READER_Uncompressed> >(target, targetRect, scaledPosition);
+	renderUnscaledNoMD<READER_Uncompressed, true>(target, targetRect, scaledPosition);
 }
 
 void CelObj::drawUncompNoFlipNoMDNoSkip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
-	render<MAPPER_NoMDNoSkip, SCALER_NoScale<false, READER_Uncompressed> >(target, targetRect, scaledPosition);
+	renderUnscaledNoMD<READER_Uncompressed, false>(target, targetRect, scaledPosition);
 }
 
 void CelObj::drawUncompHzFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
@@ -946,16 +1090,13 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 	_compressionType = kCelCompressionInvalid;
 	_transparent = true;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjView *const cachedCelObj = dynamic_cast<CelObjView *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjView *const cachedCelObj = dynamic_cast<const CelObjView *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjView in cache slot %d", cacheIndex);
+			error("Expected a CelObjView in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1065,7 +1206,7 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 		_remap = analyzeForRemap();
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjView::analyzeUncompressedForRemap() const {
@@ -1165,16 +1306,13 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 	_transparent = true;
 	_remap = false;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjPic *const cachedCelObj = dynamic_cast<CelObjPic *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjPic *const cachedCelObj = dynamic_cast<const CelObjPic *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjPic in cache slot %d", cacheIndex);
+			error("Expected a CelObjPic in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1238,7 +1376,7 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 		}
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjPic::analyzeUncompressedForSkip() const {
@@ -23,6 +23,7 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource.h"
@@ -105,7 +106,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +116,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -138,18 +139,73 @@ struct CelInfo32 {
 	}
 };
 
+struct CelInfo32_Hash {
+	uint operator()(const CelInfo32 &info) const {
+		return ((uint)info.type << 28) ^ ((uint)(uint16)info.resourceId << 12) ^
+			((uint)(uint16)info.loopNo << 6) ^ (uint16)info.celNo ^
+			((uint)info.bitmap.getSegment() << 16) ^ info.bitmap.getOffset();
+	}
+};
+
 class CelObj;
-struct CelCacheEntry {
+
+/**
+ * A cache of cel objects, keyed by their CelInfo32. Entries are kept in an
+ * intrusive LRU list and the least recently used entries are evicted once
+ * either the number of entries or the memory held by them exceeds its limit.
+ * The cached cels share their pixel data with the resource or bitmap they
+ * were created from, so an entry only holds the cel object itself.
+ */
+class CelCache {
+public:
+	CelCache(const uint maxEntries, const uint32 maxSize);
+	~CelCache();
+
 	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
+	 * Returns the cached cel object matching the given CelInfo32 and marks
+	 * it as most recently used, or returns null if it is not in the cache.
 	 */
-	int id;
-	Common::ScopedPtr<CelObj> celObj;
-	CelCacheEntry() : id(0) {}
-};
+	const CelObj *find(const CelInfo32 &info);
+
+	/**
+	 * Puts a copy of the given cel object into the cache, replacing any
+	 * other entry with the same CelInfo32.
+	 */
+	void put(const CelObj &celObj);
 
-typedef Common::Array<CelCacheEntry> CelCache;
+	uint32 getSize() const { return _size; }
+	uint32 getMaxSize() const { return _maxSize; }
+	uint getEntryCount() const { return _entries.size(); }
+	uint getMaxEntryCount() const { return _maxEntries; }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getEvictions() const { return _evictions; }
+	void resetStats() { _hits = _misses = _evictions = 0; }
+
+private:
+	struct Entry {
+		CelObj *celObj;
+		uint32 size;
+		Entry *prev; /**< The next more recently used entry */
+		Entry *next; /**< The next less recently used entry */
+	};
+
+	typedef Common::HashMap<CelInfo32, Entry *, CelInfo32_Hash> EntryMap;
+
+	void linkEntry(Entry *entry);
+	void unlinkEntry(Entry *entry);
+	void eraseEntry(Entry *entry);
+
+	EntryMap _entries;
+	Entry *_head;
+	Entry *_tail;
+	uint _maxEntries;
+	uint32 _size;
+	uint32 _maxSize;
+	uint32 _hits;
+	uint32 _misses;
+	uint32 _evictions;
+};
 
 #pragma mark -
 #pragma mark CelScaler
@@ -167,7 +223,7 @@ struct CelScalerTable {
 	 * to read from the source bitmap when drawing a scaled version of the
 	 * source bitmap.
 	 */
-	int valuesX[kCelScalerTableSize];
+	const int *valuesX;
 
 	/**
 	 * The ratio used to generate the x-values.
@@ -179,7 +235,7 @@ struct CelScalerTable {
 	 * read from a source bitmap when drawing a scaled version of the source
 	 * bitmap.
 	 */
-	int valuesY[kCelScalerTableSize];
+	const int *valuesY;
 
 	/**
 	 * The ratio used to generate the y-values.
@@ -189,21 +245,46 @@ struct CelScalerTable {
 
 class CelScaler {
 	/**
-	 * Cached scale tables.
+	 * A cached lookup table for a single ratio. The same table is used for
+	 * both axes, since the tables only depend on the ratio.
+	 */
+	struct LookupTable {
+		Ratio ratio;
+		int *values;
+		uint32 lastUse;
+	};
+
+	/**
+	 * Cached lookup tables.
 	 */
-	CelScalerTable _scaleTables[2];
+	Common::Array<LookupTable> _lookupTables;
 
 	/**
-	 * The index of the most recently used scale table.
+	 * The maximum number of cached lookup tables, derived from the byte
+	 * budget of the cache.
 	 */
-	int _activeIndex;
+	uint _maxLookupTables;
 
 	/**
-	 * Activates a scale table for the given X and Y ratios. If there is no
-	 * table that matches the given ratios, the least most recently used table
-	 * will be replaced and activated.
+	 * Incremented whenever a lookup table is used, to find the least recently
+	 * used one for replacement.
 	 */
-	void activateScaleTables(const Ratio &scaleX, const Ratio &scaleY);
+	uint32 _clock;
+
+	/**
+	 * The most recently retrieved scale table.
+	 */
+	CelScalerTable _activeTable;
+
+	uint32 _hits;
+	uint32 _misses;
+
+	/**
+	 * Returns the lookup table for the given ratio, building it if it is not
+	 * cached. If the cache is full, the least recently used table other than
+	 * `keep` is replaced.
+	 */
+	const int *getLookupTable(const Ratio &ratio, const int *keep);
 
 	/**
 	 * Builds a pixel lookup table in `table` for the given ratio. The table
@@ -213,25 +294,22 @@ class CelScaler {
 	void buildLookupTable(int *table, const Ratio &ratio, const int size);
 
 public:
-	CelScaler() :
-		_scaleTables(),
-		_activeIndex(0) {
-		CelScalerTable &table = _scaleTables[0];
-		table.scaleX = Ratio();
-		table.scaleY = Ratio();
-		for (int i = 0; i < ARRAYSIZE(table.valuesX); ++i) {
-			table.valuesX[i] = i;
-			table.valuesY[i] = i;
-		}
-		for (int i = 1; i < ARRAYSIZE(_scaleTables); ++i) {
-			_scaleTables[i] = _scaleTables[0];
-		}
-	}
+	/**
+	 * @param maxSize The byte budget for cached lookup tables. At least
+	 * enough tables for one X and Y ratio pair are always kept.
+	 */
+	CelScaler(const uint32 maxSize);
+	~CelScaler();
 
 	/**
 	 * Retrieves scaler tables for the given X and Y ratios.
 	 */
 	const CelScalerTable &getScalerTable(const Ratio &scaleX, const Ratio &scaleY);
+
+	uint getTableCount() const { return _lookupTables.size(); }
+	uint getMaxTableCount() const { return _maxLookupTables; }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
 };
 
 #pragma mark -
@@ -265,6 +343,13 @@ protected:
 public:
 	static Common::ScopedPtr<CelScaler> _scaler;
 
+	/**
+	 * Whether scaled cels are drawn with LarryScale. Engine options can only
+	 * be changed from the launcher, so this is read once in init() instead of
+	 * parsing the game options on every scaled draw.
+	 */
+	static bool _useLarryScale;
+
 	/**
 	 * The basic identifying information for this cel. This information
 	 * effectively acts as a composite key for a cel object, and any cel object
@@ -390,6 +475,12 @@ public:
 	 */
 	virtual CelObj *duplicate() const = 0;
 
+	/**
+	 * Returns the number of bytes taken by a copy of this cel made with
+	 * duplicate(), not counting the shared bitmap/resource data.
+	 */
+	virtual uint32 getObjectSize() const { return sizeof(CelObj); }
+
 	/**
 	 * Retrieves a pointer to the raw resource data for this cel. This method
 	 * cannot be used with a CelObjColor.
@@ -417,6 +508,13 @@ private:
 	template<typename MAPPER, typename SCALER>
 	void render(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition, const Ratio &scaleX, const Ratio &scaleY) const;
 
+	/**
+	 * Renders an unscaled, unmirrored cel without remapping row by row,
+	 * which is the most common way that cels are drawn.
+	 */
+	template<typename READER, bool SKIP>
+	void renderUnscaledNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
+
 	void drawHzFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
 	void drawNoFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
 	void drawUncompNoFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
@@ -447,12 +545,6 @@ private:
 #pragma mark -
 #pragma mark CelObj - Caching
 protected:
-	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
-	 */
-	static int _nextCacheId;
-
 	/**
 	 * A cache of cel objects used to avoid reinitialisation overhead for cels
 	 * with the same CelInfo32.
@@ -460,17 +552,21 @@ protected:
 	static Common::ScopedPtr<CelCache> _cache;
 
 	/**
-	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
-	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
-	 * the oldest item in the cache, which can be used to replace the oldest
-	 * item with a newer item.
+	 * Searches the cel cache for a CelObj matching the provided CelInfo32.
+	 * If not found, null is returned.
 	 */
-	int searchCache(const CelInfo32 &celInfo, int *nextInsertIndex) const;
+	const CelObj *searchCache(const CelInfo32 &celInfo) const;
 
 	/**
-	 * Puts a copy of this CelObj into the cache at the given cache index.
+	 * Puts a copy of this CelObj into the cache.
+	 */
+	void putCopyInCache() const;
+
+public:
+	/**
+	 * Returns the cel cache, for the debugger.
 	 */
-	void putCopyInCache(int index) const;
+	static CelCache *getCache() { return _cache.get(); }
 };
 
 #pragma mark -
@@ -554,6 +650,7 @@ public:
 	virtual void draw(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition, const bool mirrorX) override;
 
 	virtual CelObjPic *duplicate() const override;
+	virtual uint32 getObjectSize() const override { return sizeof(CelObjPic); }
 	virtual const SciSpan<const byte> getResPointer() const override;
 };
 
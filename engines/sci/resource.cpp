@@ -22,6 +22,7 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
@@ -206,6 +207,9 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : SciSpan<const byte>
 	_fileOffset = 0;
 	_status = kResStatusNoMalloc;
 	_lockers = 0;
+	_lruPrev = nullptr;
+	_lruNext = nullptr;
+	_lruStamp = 0;
 	_source = nullptr;
 	_header = nullptr;
 	_headerSize = 0;
@@ -972,7 +976,12 @@ void ResourceManager::init() {
 	_maxMemoryLRU = 256 * 1024; // 256KiB
 	_memoryLocked = 0;
 	_memoryLRU = 0;
-	_LRU.clear();
+	for (int i = 0; i < kResourceBudgetMax; i++) {
+		_LRU[i].head = _LRU[i].tail = nullptr;
+		_LRU[i].memory = 0;
+		_LRU[i].maxMemory = 0;
+	}
+	_lruClock = 0;
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
@@ -1032,6 +1041,9 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+	if (!_detectionMode)
+		readResourceBudgets();
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1073,12 +1085,61 @@ ResourceManager::~ResourceManager() {
 	}
 }
 
+ResourceBudget ResourceManager::getResourceBudget(ResourceType type) {
+	switch (type) {
+	case kResourceTypeView:
+		return kResourceBudgetView;
+	case kResourceTypePic:
+		return kResourceBudgetPic;
+	case kResourceTypeSound:
+	case kResourceTypeAudio:
+	case kResourceTypeSync:
+	case kResourceTypeAudio36:
+	case kResourceTypeSync36:
+	case kResourceTypeCdAudio:
+		return kResourceBudgetAudio;
+	case kResourceTypeScript:
+	case kResourceTypeHeap:
+		return kResourceBudgetScript;
+	default:
+		return kResourceBudgetOther;
+	}
+}
+
+void ResourceManager::readResourceBudgets() {
+	static const char *const budgetKeys[kResourceBudgetMax] = {
+		"resource_cache_views",
+		"resource_cache_pics",
+		"resource_cache_audio",
+		"resource_cache_scripts",
+		nullptr
+	};
+
+	if (ConfMan.hasKey("resource_cache_size"))
+		_maxMemoryLRU = MAX(ConfMan.getInt("resource_cache_size"), 0) * 1024;
+
+	for (int i = 0; i < kResourceBudgetMax; i++) {
+		if (budgetKeys[i] && ConfMan.hasKey(budgetKeys[i]))
+			_LRU[i].maxMemory = MAX(ConfMan.getInt(budgetKeys[i]), 0) * 1024;
+	}
+}
+
 void ResourceManager::removeFromLRU(Resource *res) {
 	if (res->_status != kResStatusEnqueued) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+	LRUQueue &queue = _LRU[getResourceBudget(res->getType())];
+	if (res->_lruPrev)
+		res->_lruPrev->_lruNext = res->_lruNext;
+	else
+		queue.head = res->_lruNext;
+	if (res->_lruNext)
+		res->_lruNext->_lruPrev = res->_lruPrev;
+	else
+		queue.tail = res->_lruPrev;
+	res->_lruPrev = res->_lruNext = nullptr;
+	queue.memory -= res->size();
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1088,7 +1149,16 @@ void ResourceManager::addToLRU(Resource *res) {
 		warning("resMan: trying to enqueue resource with state %d", res->_status);
 		return;
 	}
-	_LRU.push_front(res);
+	LRUQueue &queue = _LRU[getResourceBudget(res->getType())];
+	res->_lruPrev = nullptr;
+	res->_lruNext = queue.head;
+	if (queue.head)
+		queue.head->_lruPrev = res;
+	else
+		queue.tail = res;
+	queue.head = res;
+	res->_lruStamp = ++_lruClock;
+	queue.memory += res->size();
 	_memoryLRU += res->size();
 #if SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
@@ -1099,26 +1169,52 @@ void ResourceManager::addToLRU(Resource *res) {
 }
 
 void ResourceManager::printLRU() {
+	static const char *const budgetNames[kResourceBudgetMax] = {
+		"views", "pics", "audio", "scripts", "other"
+	};
+
 	int mem = 0;
 	int entries = 0;
-	Common::List<Resource *>::iterator it = _LRU.begin();
-	Resource *res;
-
-	while (it != _LRU.end()) {
-		res = *it;
-		debug("\t%s: %u bytes", res->_id.toString().c_str(), res->size());
-		mem += res->size();
-		++entries;
-		++it;
+
+	for (int i = 0; i < kResourceBudgetMax; i++) {
+		debug("%s: %d bytes, budget %d bytes", budgetNames[i], _LRU[i].memory, _LRU[i].maxMemory);
+		for (Resource *res = _LRU[i].head; res; res = res->_lruNext) {
+			debug("\t%s: %u bytes", res->_id.toString().c_str(), res->size());
+			mem += res->size();
+			++entries;
+		}
 	}
 
 	debug("Total: %d entries, %d bytes (mgr says %d)", entries, mem, _memoryLRU);
 }
 
 void ResourceManager::freeOldResources() {
-	while (_maxMemoryLRU < _memoryLRU) {
-		assert(!_LRU.empty());
-		Resource *goner = _LRU.back();
+	Resource *goner;
+
+	for (;;) {
+		goner = nullptr;
+
+		// Resource groups with a budget of their own give up their least
+		// recently used resources first
+		for (int i = 0; i < kResourceBudgetMax && !goner; i++) {
+			if (_LRU[i].maxMemory && _LRU[i].memory > _LRU[i].maxMemory)
+				goner = _LRU[i].tail;
+		}
+
+		// Otherwise, free the least recently used resource of all groups
+		// until the overall budget is met
+		if (!goner && _maxMemoryLRU < _memoryLRU) {
+			for (int i = 0; i < kResourceBudgetMax; i++) {
+				Resource *tail = _LRU[i].tail;
+				if (tail && (!goner || (int32)(tail->_lruStamp - goner->_lruStamp) < 0))
+					goner = tail;
+			}
+			assert(goner);
+		}
+
+		if (!goner)
+			break;
+
 		removeFromLRU(goner);
 		goner->unalloc();
 #ifdef SCI_VERBOSE_RESMAN
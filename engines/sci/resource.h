@@ -79,6 +79,19 @@ enum {
 	MAX_OPENED_VOLUMES = 5 ///< Max number of simultaneously opened volumes
 };
 
+/**
+ * Groups of resource types which are given their own LRU queue, so that a
+ * memory budget can be set for each of them.
+ */
+enum ResourceBudget {
+	kResourceBudgetView = 0,
+	kResourceBudgetPic,
+	kResourceBudgetAudio,
+	kResourceBudgetScript,
+	kResourceBudgetOther,
+	kResourceBudgetMax
+};
+
 enum ResourceType {
 	kResourceTypeView = 0,
 	kResourceTypePic,
@@ -296,6 +309,9 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	Resource *_lruPrev; /**< Next more recently used resource in the LRU queue */
+	Resource *_lruNext; /**< Next less recently used resource in the LRU queue */
+	uint32 _lruStamp; /**< Value of the LRU clock when the resource was enqueued */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -474,12 +490,21 @@ protected:
 	// issued whenever this limit is exceeded.
 	int _maxMemoryLRU;
 
+	/** An intrusive LRU queue, ordered from most to least recently used */
+	struct LRUQueue {
+		Resource *head;
+		Resource *tail;
+		int memory;    ///< Amount of resource bytes in this queue
+		int maxMemory; ///< Budget for this queue, or 0 for no budget of its own
+	};
+
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
 	typedef Common::List<ResourceSource *> SourcesList;
 	SourcesList _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
-	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	LRUQueue _LRU[kResourceBudgetMax]; ///< Last Resource Used queues
+	uint32 _lruClock; ///< Incremented whenever a resource is enqueued
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
@@ -615,6 +640,20 @@ protected:
 	void addToLRU(Resource *res);
 	void removeFromLRU(Resource *res);
 
+	/**
+	 * Returns the LRU queue which holds resources of the given type.
+	 */
+	static ResourceBudget getResourceBudget(ResourceType type);
+
+	/**
+	 * Reads the resource cache budgets from the configuration. All values are
+	 * in KiB; "resource_cache_size" replaces the overall budget and
+	 * "resource_cache_views", "resource_cache_pics", "resource_cache_audio"
+	 * and "resource_cache_scripts" limit single resource groups, e.g. on
+	 * low-memory targets.
+	 */
+	void readResourceBudgets();
+
 	ResourceCompression getViewCompression();
 	ViewType detectViewType();
 	bool hasSci0Voc999();
@@ -30,6 +30,9 @@
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
 #include "scumm/imuse/imuse.h"
+#ifdef ENABLE_SCUMM_7_8
+#include "scumm/imuse_digi/dimuse.h"
+#endif
 #include "scumm/object.h"
 #include "scumm/resource.h"
 #include "scumm/scumm.h"
@@ -37,6 +40,8 @@
 
 namespace Scumm {
 
+extern const char *nameOfResType(ResType type);
+
 void debugC(int channel, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
@@ -79,6 +84,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
+	registerCmd("resources", WRAP_METHOD(ScummDebugger, Cmd_Resources));
 
 	if (_vm->_game.id == GID_LOOM)
 		registerCmd("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
@@ -166,6 +172,18 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 				debugPrintf("Specify a music resource # or \"all\".\n");
 			}
 			return true;
+#ifdef ENABLE_SCUMM_7_8
+		} else if (!strcmp(argv[1], "bundle") && _vm->_imuseDigital) {
+			bool reset = (argc > 2 && !strcmp(argv[2], "reset"));
+			BundleBlockStats stats = _vm->_imuseDigital->getBundleStats(reset);
+			uint32 reads = stats.hits + stats.stalls;
+			debugPrintf("Bundle blocks read: %d, cached: %d, stalls: %d (%d%%)\n", reads, stats.hits, stats.stalls,
+				reads ? (int)((uint64)stats.stalls * 100 / reads) : 0);
+			debugPrintf("Read-ahead decoded: %d, used: %d, evictions: %d\n", stats.prefetched, stats.prefetchUsed, stats.evictions);
+			if (reset)
+				debugPrintf("Counters reset\n");
+			return true;
+#endif
 		}
 	}
 
@@ -173,6 +191,46 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 	debugPrintf("  panic - Stop all music tracks\n");
 	debugPrintf("  play # - Play a music resource\n");
 	debugPrintf("  stop # - Stop a music resource\n");
+#ifdef ENABLE_SCUMM_7_8
+	if (_vm->_imuseDigital)
+		debugPrintf("  bundle [reset] - Show bundle block cache counters\n");
+#endif
+	return true;
+}
+
+bool ScummDebugger::Cmd_Resources(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	ResourceManager *res = _vm->_res;
+	debugPrintf("Type        Loaded  Locked  Bytes\n");
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		int loaded = 0, locked = 0;
+		uint32 size = 0;
+		for (ResId idx = 0; idx < res->_types[type].size(); idx++) {
+			const ResourceManager::Resource &r = res->_types[type][idx];
+			if (!r._address)
+				continue;
+			loaded++;
+			size += r._size;
+			if (r.isLocked())
+				locked++;
+		}
+		if (loaded)
+			debugPrintf("%-10s  %6d  %6d  %u\n", nameOfResType(type), loaded, locked, size);
+	}
+	debugPrintf("Heap: %u bytes, thresholds %u / %u\n", res->getAllocatedSize(),
+		res->getMinHeapThreshold(), res->getMaxHeapThreshold());
+
+	uint32 count, size, skipped;
+	res->getPrefetchStats(count, size, skipped);
+	debugPrintf("Prefetched on room entry: %u resources, %u bytes, %u skipped for lack of heap\n", count, size, skipped);
+	if (argc == 2) {
+		res->resetPrefetchStats();
+		debugPrintf("Prefetch counters reset\n");
+	}
 	return true;
 }
 
@@ -350,6 +350,13 @@ void IMuseDigital::callback() {
 					feedSize -= curFeedSize;
 					assert(feedSize >= 0);
 				} while (feedSize != 0);
+
+				// Decode the blocks needed by the next ticks now, so a block
+				// boundary or a region jump doesn't stall a single callback
+				if (track->stream && track->curRegion != -1) {
+					int32 dataOffset = (bits == 12) ? (track->regionOffset * 3) / 4 : track->regionOffset;
+					_sound->readAheadRegion(track->soundDesc, track->curRegion, dataOffset, track->curHookId);
+				}
 			}
 			if (_mixer->isReady()) {
 				_mixer->setChannelVolume(track->mixChanHandle, track->getVol());
@@ -162,6 +162,9 @@ public:
 	int32 getCurMusicLipSyncWidth(int syncId);
 	int32 getCurMusicLipSyncHeight(int syncId);
 	int32 getSoundElapsedTimeInMs(int soundId);
+
+	/** Returns the bundle block cache counters, optionally clearing them. */
+	BundleBlockStats getBundleStats(bool reset);
 };
 
 } // End of namespace Scumm
@@ -38,6 +38,7 @@ BundleDirCache::BundleDirCache() {
 		_budleDirCache[fileId].isCompressed = false;
 		_budleDirCache[fileId].indexTable = NULL;
 	}
+	_blockStats.reset();
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -149,6 +150,8 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
+	_blockCache = NULL;
+	_blockClock = 0;
 }
 
 BundleMgr::~BundleMgr() {
@@ -193,8 +196,6 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 	_indexTable = _cache->getIndexTable(slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
-	_outputSize = 0;
-	_lastBlock = -1;
 
 	return true;
 }
@@ -206,13 +207,13 @@ void BundleMgr::close() {
 		_numFiles = 0;
 		_numCompItems = 0;
 		_compTableLoaded = false;
-		_lastBlock = -1;
-		_outputSize = 0;
 		_curSampleId = -1;
 		free(_compTable);
 		_compTable = NULL;
 		free(_compInputBuff);
 		_compInputBuff = NULL;
+		free(_blockCache);
+		_blockCache = NULL;
 	}
 }
 
@@ -243,9 +244,53 @@ bool BundleMgr::loadCompTable(int32 index) {
 	_compInputBuff = (byte *)malloc(maxSize + 1);
 	assert(_compInputBuff);
 
+	if (!_blockCache) {
+		_blockCache = (CachedBlock *)malloc(sizeof(CachedBlock) * kBlockCacheSlots);
+		assert(_blockCache);
+	}
+	for (int i = 0; i < kBlockCacheSlots; i++)
+		_blockCache[i].block = -1;
+
 	return true;
 }
 
+BundleMgr::CachedBlock *BundleMgr::findBlock(int32 block) {
+	for (int i = 0; i < kBlockCacheSlots; i++) {
+		if (_blockCache[i].block == block)
+			return &_blockCache[i];
+	}
+	return NULL;
+}
+
+BundleMgr::CachedBlock *BundleMgr::decodeBlock(int32 block) {
+	// Reuse a free slot if there is one, otherwise the least recently used
+	CachedBlock *slot = &_blockCache[0];
+	for (int i = 0; i < kBlockCacheSlots; i++) {
+		if (_blockCache[i].block == -1) {
+			slot = &_blockCache[i];
+			break;
+		}
+		if (_blockCache[i].lastUse < slot->lastUse)
+			slot = &_blockCache[i];
+	}
+	if (slot->block != -1)
+		_cache->getBlockStats().evictions++;
+
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[_curSampleId].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	slot->size = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, slot->data, _compTable[block].size);
+	if (slot->size > kBlockSize) {
+		error("_outputSize: %d", slot->size);
+	}
+	slot->block = block;
+	slot->lastUse = ++_blockClock;
+	slot->prefetched = false;
+
+	return slot;
+}
+
 int32 BundleMgr::decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside) {
 	return decompressSampleByIndex(_curSampleId, offset, size, compFinal, headerSize, headerOutside);
 }
@@ -286,20 +331,22 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	skip = (offset + headerSize) % 0x2000;
 
+	BundleBlockStats &stats = _cache->getBlockStats();
 	for (i = firstBlock; i <= lastBlock; i++) {
-		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
+		CachedBlock *block = findBlock(i);
+		if (block) {
+			stats.hits++;
+			if (block->prefetched) {
+				stats.prefetchUsed++;
+				block->prefetched = false;
 			}
-			_lastBlock = i;
+			block->lastUse = ++_blockClock;
+		} else {
+			stats.stalls++;
+			block = decodeBlock(i);
 		}
 
-		outputSize = _outputSize;
+		outputSize = block->size;
 
 		if (headerOutside) {
 			outputSize -= skip;
@@ -316,7 +363,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 		assert(finalSize + outputSize <= blocksFinalSize);
 
-		memcpy(*compFinal + finalSize, _compOutputBuff + skip, outputSize);
+		memcpy(*compFinal + finalSize, block->data + skip, outputSize);
 		finalSize += outputSize;
 
 		size -= outputSize;
@@ -330,6 +377,29 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	return finalSize;
 }
 
+bool BundleMgr::prefetchSampleByCurIndex(int32 offset, int32 size, int headerSize) {
+	// Nothing has been read from this bundle yet, so there is no block
+	// table to look at. The first read loads it.
+	if (!_file->isOpen() || !_compTableLoaded || _curSampleId == -1 || size <= 0)
+		return false;
+
+	int32 firstBlock = (offset + headerSize) / kBlockSize;
+	int32 lastBlock = (offset + headerSize + size - 1) / kBlockSize;
+	if (lastBlock >= _numCompItems)
+		lastBlock = _numCompItems - 1;
+
+	for (int32 i = firstBlock; i <= lastBlock; i++) {
+		if (findBlock(i))
+			continue;
+		CachedBlock *block = decodeBlock(i);
+		block->prefetched = true;
+		_cache->getBlockStats().prefetched++;
+		return true;
+	}
+
+	return false;
+}
+
 int32 BundleMgr::decompressSampleByName(const char *name, int32 offset, int32 size, byte **comp_final, bool header_outside) {
 	int32 final_size = 0;
 
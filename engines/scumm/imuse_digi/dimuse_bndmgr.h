@@ -30,6 +30,21 @@ namespace Scumm {
 
 class BaseScummFile;
 
+/**
+ * Counters for the decoded block caches of all bundles sharing one
+ * BundleDirCache. A stall is a block which had to be decoded while the
+ * mixer callback was waiting for its data.
+ */
+struct BundleBlockStats {
+	uint32 hits;
+	uint32 stalls;
+	uint32 prefetched;
+	uint32 prefetchUsed;
+	uint32 evictions;
+
+	void reset() { memset(this, 0, sizeof(*this)); }
+};
+
 class BundleDirCache {
 public:
 	struct AudioTable {
@@ -53,6 +68,8 @@ private:
 		IndexNode *indexTable;
 	} _budleDirCache[4];
 
+	BundleBlockStats _blockStats;
+
 public:
 	BundleDirCache();
 	~BundleDirCache();
@@ -62,9 +79,17 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+	BundleBlockStats &getBlockStats() { return _blockStats; }
 };
 
 class BundleMgr {
+public:
+
+	enum {
+		kBlockSize = 0x2000,
+		kBlockCacheSlots = 6,
+		kReadAheadBlocks = 2
+	};
 
 private:
 
@@ -74,6 +99,14 @@ private:
 		int32 codec;
 	};
 
+	struct CachedBlock {
+		int32 block;		// index into _compTable, -1 if the slot is free
+		int32 size;			// decoded size
+		uint32 lastUse;
+		bool prefetched;	// decoded ahead of time and not consumed yet
+		byte data[kBlockSize];
+	};
+
 	BundleDirCache *_cache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable;
@@ -85,12 +118,13 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
-	int _outputSize;
-	int _lastBlock;
+	CachedBlock *_blockCache;
+	uint32 _blockClock;
 
 	bool loadCompTable(int32 index);
+	CachedBlock *findBlock(int32 block);
+	CachedBlock *decodeBlock(int32 block);
 
 public:
 
@@ -103,6 +137,14 @@ public:
 	int32 decompressSampleByName(const char *name, int32 offset, int32 size, byte **compFinal, bool headerOutside);
 	int32 decompressSampleByIndex(int32 index, int32 offset, int32 size, byte **compFinal, int header_size, bool headerOutside);
 	int32 decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside);
+
+	/**
+	 * Decode the first block covering the given range of the current sample
+	 * which is not cached yet. At most one block is decoded per call, so
+	 * callers can spread the decoding work over several timer ticks.
+	 * @return true if a block was decoded
+	 */
+	bool prefetchSampleByCurIndex(int32 offset, int32 size, int headerSize);
 };
 
 } // End of namespace Scumm
@@ -334,6 +334,15 @@ void IMuseDigital::stopSound(int soundId) {
 	}
 }
 
+BundleBlockStats IMuseDigital::getBundleStats(bool reset) {
+	Common::StackLock lock(_mutex, "IMuseDigital::getBundleStats()");
+	BundleBlockStats &stats = _sound->getBundleStats();
+	BundleBlockStats result = stats;
+	if (reset)
+		stats.reset();
+	return result;
+}
+
 int32 IMuseDigital::getCurMusicPosInMs() {
 	Common::StackLock lock(_mutex, "IMuseDigital::getCurMusicPosInMs()");
 	int soundId = -1;
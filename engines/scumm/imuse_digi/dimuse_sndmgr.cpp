@@ -633,6 +633,52 @@ int ImuseDigiSndMgr::getJumpFade(SoundDesc *soundDesc, int number) {
 	return soundDesc->jump[number].fadeDelay;
 }
 
+void ImuseDigiSndMgr::readAheadRegion(SoundDesc *soundDesc, int region, int32 offset, int hookId) {
+	assert(checkForProperHandle(soundDesc));
+	assert(region >= 0 && region < soundDesc->numRegions);
+
+	// Only uncompressed bundles decode blocks on the mixer path
+	if (!soundDesc->bundle || soundDesc->compressed)
+		return;
+
+	BundleMgr *bundle = soundDesc->bundle;
+	int32 window = BundleMgr::kReadAheadBlocks * BundleMgr::kBlockSize;
+	int32 offsetData = soundDesc->offsetData;
+	int32 left = soundDesc->region[region].length - offsetData - offset;
+	if (left > 0) {
+		int32 start = soundDesc->region[region].offset - offsetData;
+		if (bundle->prefetchSampleByCurIndex(start + offset, MIN(left, window), offsetData))
+			return;
+		if (left >= window)
+			return;
+		window -= left;
+	}
+
+	// Predict the next region the same way switchToNextRegion() picks it
+	int next = region + 1;
+	if (next >= soundDesc->numRegions)
+		return;
+	int32 nextOffset = soundDesc->region[next].offset;
+	for (int l = 0; l < soundDesc->numJumps; l++) {
+		if (soundDesc->jump[l].offset == nextOffset && soundDesc->jump[l].hookId == hookId) {
+			for (int r = 0; r < soundDesc->numRegions; r++) {
+				if (soundDesc->region[r].offset == soundDesc->jump[l].dest) {
+					next = r;
+					break;
+				}
+			}
+			break;
+		}
+	}
+
+	int32 length = MIN<int32>(soundDesc->region[next].length - offsetData, window);
+	bundle->prefetchSampleByCurIndex(soundDesc->region[next].offset - offsetData, length, offsetData);
+}
+
+BundleBlockStats &ImuseDigiSndMgr::getBundleStats() {
+	return _cacheBundleDir->getBlockStats();
+}
+
 int32 ImuseDigiSndMgr::getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size) {
 	debug(6, "getDataFromRegion() region:%d, offset:%d, size:%d, numRegions:%d", region, offset, size, soundDesc->numRegions);
 	assert(checkForProperHandle(soundDesc));
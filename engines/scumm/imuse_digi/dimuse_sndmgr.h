@@ -39,6 +39,7 @@ namespace Scumm {
 class ScummEngine;
 class BundleMgr;
 class BundleDirCache;
+struct BundleBlockStats;
 
 class ImuseDigiSndMgr {
 public:
@@ -154,6 +155,16 @@ public:
 	void getSyncSizeAndPtrById(SoundDesc *soundDesc, int number, int32 &sync_size, byte **sync_ptr);
 
 	int32 getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size);
+
+	/**
+	 * Decode bundle blocks ahead of the read position of a track. Once the
+	 * end of the region is near, the region the track continues with is
+	 * predicted from the jump table and its first blocks are decoded too.
+	 * At most one block is decoded per call.
+	 */
+	void readAheadRegion(SoundDesc *soundDesc, int region, int32 offset, int hookId);
+
+	BundleBlockStats &getBundleStats();
 };
 
 } // End of namespace Scumm
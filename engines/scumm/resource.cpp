@@ -20,11 +20,13 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/str.h"
 #ifndef MACOSX
 #include "common/config-manager.h"
 #endif
 
+#include "scumm/actor.h"
 #include "scumm/charset.h"
 #include "scumm/dialogs.h"
 #include "scumm/file.h"
@@ -616,6 +618,92 @@ void ScummEngine::ensureResourceLoaded(ResType type, ResId idx) {
 
 	if (_game.version == 5 && type == rtRoom && (int)idx == _roomResource)
 		VAR(VAR_ROOM_FLAG) = 1;
+
+	if (_currentRoom != 0 && (type == rtCostume || type == rtScript || type == rtSound || type == rtCharset)
+			&& _res->isResourceLoaded(type, idx))
+		_res->noteRoomResource(_currentRoom, type, idx);
+}
+
+namespace {
+
+struct PrefetchEntry {
+	ResType type;
+	ResId idx;
+	int roomNr;
+	uint32 offset;
+};
+
+struct PrefetchEntryLess {
+	bool operator()(const PrefetchEntry &a, const PrefetchEntry &b) const {
+		if (a.roomNr != b.roomNr)
+			return a.roomNr < b.roomNr;
+		return a.offset < b.offset;
+	}
+};
+
+} // End of anonymous namespace
+
+void ScummEngine::prefetchRoomResources() {
+	// Old games map costumes to their data in ways loadResource() doesn't
+	// know about, and they are small enough not to matter
+	if (_game.version < 4)
+		return;
+
+	Common::Array<PrefetchEntry> entries;
+
+	// Besides the costumes of the actors already placed in the room, load
+	// what the room asked for during earlier visits. This covers whatever
+	// the entry script and the room's objects and actors load on demand.
+	ResourceManager::RoomResourceList candidates;
+	for (int i = 1; i < _numActors; i++) {
+		const Actor *a = _actors[i];
+		if (a->isInCurrentRoom() && a->_costume != 0) {
+			ResourceManager::RoomResource res;
+			res.type = rtCostume;
+			res.idx = a->_costume;
+			candidates.push_back(res);
+		}
+	}
+	const ResourceManager::RoomResourceList *history = _res->getRoomResources(_currentRoom);
+	if (history)
+		candidates.push_back(*history);
+
+	for (uint i = 0; i < candidates.size(); i++) {
+		const ResType type = candidates[i].type;
+		const ResId idx = candidates[i].idx;
+		if (idx >= _res->_types[type].size() || _res->isResourceLoaded(type, idx))
+			continue;
+		uint32 offset = getResourceRoomOffset(type, idx);
+		if (offset == RES_INVALID_OFFSET)
+			continue;
+
+		bool found = false;
+		for (uint j = 0; j < entries.size() && !found; j++)
+			found = (entries[j].type == type && entries[j].idx == idx);
+		if (found)
+			continue;
+
+		PrefetchEntry entry;
+		entry.type = type;
+		entry.idx = idx;
+		entry.roomNr = getResourceRoomNr(type, idx);
+		if (entry.roomNr == 0)
+			entry.roomNr = _roomResource;
+		entry.offset = offset;
+		entries.push_back(entry);
+	}
+
+	// Load in file order, so the reads only ever seek forward within a room
+	Common::sort(entries.begin(), entries.end(), PrefetchEntryLess());
+
+	for (uint i = 0; i < entries.size(); i++) {
+		if (!_res->canPrefetch()) {
+			_res->notePrefetchSkipped();
+			continue;
+		}
+		if (loadResource(entries[i].type, entries[i].idx))
+			_res->notePrefetch(entries[i].type, entries[i].idx);
+	}
 }
 
 int ScummEngine::loadResource(ResType type, ResId idx) {
@@ -872,6 +960,9 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_prefetchCount = 0;
+	_prefetchSize = 0;
+	_prefetchSkipped = 0;
 }
 
 ResourceManager::~ResourceManager() {
@@ -1119,6 +1210,47 @@ bool ResourceManager::isResourceLoaded(ResType type, ResId idx) const {
 	return _types[type][idx]._address != NULL;
 }
 
+bool ResourceManager::canPrefetch() const {
+	return _allocatedSize < _minHeapThreshold + (_maxHeapThreshold - _minHeapThreshold) / 2;
+}
+
+void ResourceManager::notePrefetch(ResType type, ResId idx) {
+	_prefetchCount++;
+	_prefetchSize += _types[type][idx]._size;
+}
+
+void ResourceManager::noteRoomResource(int room, ResType type, ResId idx) {
+	RoomResourceList &list = _roomResources[room];
+	if (list.size() >= kMaxRoomResources)
+		return;
+	for (uint i = 0; i < list.size(); i++) {
+		if (list[i].type == type && list[i].idx == idx)
+			return;
+	}
+
+	RoomResource res;
+	res.type = type;
+	res.idx = idx;
+	list.push_back(res);
+}
+
+const ResourceManager::RoomResourceList *ResourceManager::getRoomResources(int room) const {
+	Common::HashMap<int, RoomResourceList>::const_iterator it = _roomResources.find(room);
+	return it != _roomResources.end() ? &it->_value : nullptr;
+}
+
+void ResourceManager::getPrefetchStats(uint32 &count, uint32 &size, uint32 &skipped) const {
+	count = _prefetchCount;
+	size = _prefetchSize;
+	skipped = _prefetchSkipped;
+}
+
+void ResourceManager::resetPrefetchStats() {
+	_prefetchCount = 0;
+	_prefetchSize = 0;
+	_prefetchSkipped = 0;
+}
+
 void ResourceManager::resourceStats() {
 	uint32 lockedSize = 0, lockedNum = 0;
 
@@ -24,6 +24,7 @@
 #define SCUMM_RESOURCE_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
 #include "scumm/scumm.h"	// for ResType
 
 namespace Scumm {
@@ -171,16 +172,62 @@ public:
 	};
 	ResTypeData _types[rtLast + 1];
 
+	/**
+	 * A resource which was loaded while a room was the current one.
+	 */
+	struct RoomResource {
+		ResType type;
+		ResId idx;
+	};
+	typedef Common::Array<RoomResource> RoomResourceList;
+
+	/**
+	 * The maximum number of resources remembered per room. The first loads
+	 * in a room are the ones its entry script and actors cause.
+	 */
+	enum { kMaxRoomResources = 32 };
+
 protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
 
+	uint32 _prefetchCount, _prefetchSize, _prefetchSkipped;
+
+	Common::HashMap<int, RoomResourceList> _roomResources;
+
 public:
 	ResourceManager(ScummEngine *vm);
 	~ResourceManager();
 
 	void setHeapThreshold(int min, int max);
+	uint32 getAllocatedSize() const { return _allocatedSize; }
+	uint32 getMinHeapThreshold() const { return _minHeapThreshold; }
+	uint32 getMaxHeapThreshold() const { return _maxHeapThreshold; }
+
+	/**
+	 * Whether a resource which is not needed yet may be loaded. Prefetching
+	 * stops halfway between the two heap thresholds, so that it never
+	 * causes resources to expire.
+	 */
+	bool canPrefetch() const;
+	void notePrefetch(ResType type, ResId idx);
+	void notePrefetchSkipped() { _prefetchSkipped++; }
+
+	/**
+	 * Remembers that a resource was loaded on demand while the given room
+	 * was the current one, so that it can be prefetched when the room is
+	 * entered again.
+	 */
+	void noteRoomResource(int room, ResType type, ResId idx);
+
+	/**
+	 * Returns the resources remembered for the given room, or null if the
+	 * room did not load any yet.
+	 */
+	const RoomResourceList *getRoomResources(int room) const;
+	void getPrefetchStats(uint32 &count, uint32 &size, uint32 &skipped) const;
+	void resetPrefetchStats();
 
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
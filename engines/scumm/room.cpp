@@ -188,6 +188,8 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 		}
 	}
 
+	prefetchRoomResources();
+
 	showActors();
 
 	_egoPositioned = false;
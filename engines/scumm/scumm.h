@@ -765,6 +765,14 @@ public:
 	byte *getStringAddressVar(int i);
 	void ensureResourceLoaded(ResType type, ResId idx);
 
+	/**
+	 * Load the resources the current room is expected to need, in data file
+	 * order and as long as the heap has room: the costumes of the actors
+	 * placed in it, and whatever its scripts and actors loaded on demand
+	 * during earlier visits.
+	 */
+	void prefetchRoomResources();
+
 protected:
 	int readSoundResource(ResId idx);
 	int readSoundResourceSmallHeader(ResId idx);
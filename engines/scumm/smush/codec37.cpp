@@ -325,6 +325,26 @@ void Codec37Decoder::maketable(int pitch, int index) {
 		dst += 4;						  \
 	} while (0)
 
+bool Codec37Decoder::copyBlockRun(byte *&dst, int32 next_offs, int32 length, int32 &i, int &bh, int bw, int pitch) {
+	// Runs of unchanged blocks are copied from the previous frame one
+	// block row at a time, so each pixel row is a single copy
+	while (length > 0) {
+		int32 run = MIN(length, i);
+		for (int x = 0; x < 4; x++)
+			memcpy(dst + pitch * x, dst + next_offs + pitch * x, run * 4);
+		dst += run * 4;
+		length -= run;
+		i -= run;
+		if (i == 0) {
+			dst += pitch * 3;
+			i = bw;
+			if (--bh == 0)
+				return true;
+		}
+	}
+	return false;
+}
+
 void Codec37Decoder::proc1(byte *dst, const byte *src, int32 next_offs, int bw, int bh, int pitch, int16 *offset_table) {
 	uint8 code;
 	bool filling, skipCode;
@@ -439,19 +459,8 @@ void Codec37Decoder::proc4WithFDFE(byte *dst, const byte *src, int32 next_offs,
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + next_offs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
-					if (i == 0) {
-						dst += pitch * 3;
-						bh--;
-						i = bw;
-					}
-				}
-				if (bh == 0) {
+				if (copyBlockRun(dst, next_offs, length, i, bh, bw, pitch))
 					return;
-				}
 				i++;
 			} else {
 				byte *dst2 = dst + _offsetTable[code] + next_offs;
@@ -471,19 +480,8 @@ void Codec37Decoder::proc4WithoutFDFE(byte *dst, const byte *src, int32 next_off
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + next_offs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
-					if (i == 0) {
-						dst += pitch * 3;
-						bh--;
-						i = bw;
-					}
-				}
-				if (bh == 0) {
+				if (copyBlockRun(dst, next_offs, length, i, bh, bw, pitch))
 					return;
-				}
 				i++;
 			} else {
 				byte *dst2 = dst + _offsetTable[code] + next_offs;
@@ -46,6 +46,7 @@ public:
 	~Codec37Decoder();
 protected:
 	void maketable(int, int);
+	bool copyBlockRun(byte *&dst, int32 next_offs, int32 length, int32 &i, int &bh, int bw, int pitch);
 	void proc1(byte *dst, const byte *src, int32, int, int, int, int16 *);
 	void proc3WithFDFE(byte *dst, const byte *src, int32, int, int, int, int16 *);
 	void proc3WithoutFDFE(byte *dst, const byte *src, int32, int, int, int, int16 *);
@@ -45,16 +45,11 @@ namespace Scumm {
 		(dst)[1] = (src)[1];	\
 	} while (0)
 
+#define DECLARE_FILL_TEMP(v)			\
+	byte v
 
-#else /* SCUMM_NEED_ALIGNMENT */
-
-#define COPY_4X1_LINE(dst, src)			\
-	*(uint32 *)(dst) = *(const uint32 *)(src)
-
-#define COPY_2X1_LINE(dst, src)			\
-	*(uint16 *)(dst) = *(const uint16 *)(src)
-
-#endif
+#define READ_FILL_PIXEL(pixel)			\
+	(pixel)
 
 #define FILL_4X1_LINE(dst, val)			\
 	do {					\
@@ -70,6 +65,31 @@ namespace Scumm {
 		(dst)[1] = val;	\
 	} while (0)
 
+#else /* SCUMM_NEED_ALIGNMENT */
+
+#define COPY_4X1_LINE(dst, src)			\
+	*(uint32 *)(dst) = *(const uint32 *)(src)
+
+#define COPY_2X1_LINE(dst, src)			\
+	*(uint16 *)(dst) = *(const uint16 *)(src)
+
+/* Fills replicate the pixel into a word once and store whole lines */
+
+#define DECLARE_FILL_TEMP(v)			\
+	uint32 v
+
+#define READ_FILL_PIXEL(pixel)			\
+	((uint32)(pixel) * 0x01010101)
+
+#define FILL_4X1_LINE(dst, val)			\
+	*(uint32 *)(dst) = val
+
+#define FILL_2X1_LINE(dst, val)			\
+	*(uint16 *)(dst) = (uint16)(val)
+
+#endif
+
+
 static const  int8 codec47_table_small1[] = {
   0, 1, 2, 3, 3, 3, 3, 2, 1, 0, 0, 0, 1, 2, 2, 1,
 };
@@ -373,7 +393,7 @@ void Codec47Decoder::level3(byte *d_dst) {
 		COPY_2X1_LINE(d_dst + _d_pitch, _d_src + 2);
 		_d_src += 4;
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		DECLARE_FILL_TEMP(t) = READ_FILL_PIXEL(*_d_src++);
 		FILL_2X1_LINE(d_dst, t);
 		FILL_2X1_LINE(d_dst + _d_pitch, t);
 	} else if (code == 0xFC) {
@@ -381,7 +401,7 @@ void Codec47Decoder::level3(byte *d_dst) {
 		COPY_2X1_LINE(d_dst, d_dst + tmp);
 		COPY_2X1_LINE(d_dst + _d_pitch, d_dst + _d_pitch + tmp);
 	} else {
-		byte t = _paramPtr[code];
+		DECLARE_FILL_TEMP(t) = READ_FILL_PIXEL(_paramPtr[code]);
 		FILL_2X1_LINE(d_dst, t);
 		FILL_2X1_LINE(d_dst + _d_pitch, t);
 	}
@@ -407,7 +427,7 @@ void Codec47Decoder::level2(byte *d_dst) {
 		d_dst += 2;
 		level3(d_dst);
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		DECLARE_FILL_TEMP(t) = READ_FILL_PIXEL(*_d_src++);
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
@@ -435,7 +455,7 @@ void Codec47Decoder::level2(byte *d_dst) {
 			d_dst += _d_pitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		DECLARE_FILL_TEMP(t) = READ_FILL_PIXEL(_paramPtr[code]);
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
@@ -464,7 +484,7 @@ void Codec47Decoder::level1(byte *d_dst) {
 		d_dst += 4;
 		level2(d_dst);
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		DECLARE_FILL_TEMP(t) = READ_FILL_PIXEL(*_d_src++);
 		for (i = 0; i < 8; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			FILL_4X1_LINE(d_dst + 4, t);
@@ -495,7 +515,7 @@ void Codec47Decoder::level1(byte *d_dst) {
 			d_dst += _d_pitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		DECLARE_FILL_TEMP(t) = READ_FILL_PIXEL(_paramPtr[code]);
 		for (i = 0; i < 8; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			FILL_4X1_LINE(d_dst + 4, t);
@@ -230,6 +230,8 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_base = NULL;
 	_frameBuffer = NULL;
 	_specialBuffer = NULL;
+	_chunkBuffer = NULL;
+	_chunkBufferSize = 0;
 
 	_seekPos = -1;
 
@@ -310,6 +312,10 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = NULL;
 
+	free(_chunkBuffer);
+	_chunkBuffer = NULL;
+	_chunkBufferSize = 0;
+
 	_IACTstream = NULL;
 
 	_vm->_smushActive = false;
@@ -834,14 +840,18 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 	b.readUint16LE();
 	b.readUint16LE();
 
+	// The chunk buffer is kept between frames, frame objects of a video
+	// are all about the same size
 	int32 chunk_size = subSize - 14;
-	byte *chunk_buffer = (byte *)malloc(chunk_size);
-	assert(chunk_buffer);
-	b.read(chunk_buffer, chunk_size);
-
-	decodeFrameObject(codec, chunk_buffer, left, top, width, height);
+	if (chunk_size > _chunkBufferSize) {
+		free(_chunkBuffer);
+		_chunkBuffer = (byte *)malloc(chunk_size);
+		assert(_chunkBuffer);
+		_chunkBufferSize = chunk_size;
+	}
+	b.read(_chunkBuffer, chunk_size);
 
-	free(chunk_buffer);
+	decodeFrameObject(codec, _chunkBuffer, left, top, width, height);
 }
 
 void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
@@ -55,6 +55,8 @@ private:
 	uint32 _baseSize;
 	byte *_frameBuffer;
 	byte *_specialBuffer;
+	byte *_chunkBuffer;
+	int32 _chunkBufferSize;
 
 	Common::String _seekFile;
 	uint32 _startFrame;
@@ -22,14 +22,107 @@
 
 #include "sword25/console.h"
 #include "sword25/sword25.h"
+#include "sword25/kernel/kernel.h"
+#include "sword25/kernel/resmanager.h"
+#include "sword25/gfx/graphicengine.h"
+#include "sword25/gfx/renderobjectmanager.h"
+#include "sword25/script/luascript.h"
+#include "sword25/script/luaallocator.h"
+
+#include "common/lua/lua.h"
 
 namespace Sword25 {
 
 Sword25Console::Sword25Console(Sword25Engine *vm) : GUI::Debugger(), _vm(vm) {
 	assert(_vm);
+
+	registerCmd("lua", WRAP_METHOD(Sword25Console, Cmd_Lua));
+	registerCmd("gfx", WRAP_METHOD(Sword25Console, Cmd_Gfx));
+	registerCmd("resources", WRAP_METHOD(Sword25Console, Cmd_Resources));
 }
 
 Sword25Console::~Sword25Console() {
 }
 
+bool Sword25Console::Cmd_Lua(int argc, const char **argv) {
+	LuaScriptEngine *script = static_cast<LuaScriptEngine *>(Kernel::getInstance()->getScript());
+	if (!script) {
+		debugPrintf("Script engine not initialized\n");
+		return true;
+	}
+
+	LuaAllocator *allocator = script->getAllocator();
+
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		script->resetFrameStats();
+		if (allocator)
+			allocator->resetStats();
+		debugPrintf("Lua statistics reset\n");
+		return true;
+	}
+
+	const LuaScriptEngine::FrameStats &stats = script->getFrameStats();
+	uint frames = MAX<uint>(stats.frames, 1);
+	debugPrintf("Frames: %u\n", stats.frames);
+	debugPrintf("Script time: avg %u ms, max %u ms\n", stats.scriptTime / frames, stats.scriptTimeMax);
+	debugPrintf("GC time: avg %u ms, max %u ms\n", stats.gcTime / frames, stats.gcTimeMax);
+	debugPrintf("GC step size: %d KB\n", script->getGCStepSize());
+	debugPrintf("Lua heap: %d KB\n", lua_gc(static_cast<lua_State *>(script->getScriptObject()), LUA_GCCOUNT, 0));
+	if (allocator) {
+		debugPrintf("Allocator: %u bytes used, %u bytes in pool chunks\n", allocator->getUsedBytes(), allocator->getChunkBytes());
+		debugPrintf("Allocator: %u pool allocations, %u system allocations\n", allocator->getPoolAllocations(), allocator->getSystemAllocations());
+	}
+
+	return true;
+}
+
+bool Sword25Console::Cmd_Gfx(int argc, const char **argv) {
+	GraphicEngine *gfx = Kernel::getInstance()->getGfx();
+	RenderObjectManager *manager = gfx ? gfx->getRenderObjectManager() : 0;
+	if (!manager) {
+		debugPrintf("Graphics engine not initialized\n");
+		return true;
+	}
+
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		manager->resetRenderStats();
+		debugPrintf("Render statistics reset\n");
+		return true;
+	}
+
+	const RenderObjectManager::RenderStats &stats = manager->getRenderStats();
+	uint frames = MAX<uint>(stats.frames, 1);
+	debugPrintf("Frames: %u\n", stats.frames);
+	debugPrintf("Update rectangles: %u (avg %u per frame)\n", stats.tiles, stats.tiles / frames);
+	debugPrintf("Objects drawn: %u (avg %u per frame)\n", stats.objectsDrawn, stats.objectsDrawn / frames);
+	debugPrintf("Objects skipped as occluded: %u (avg %u per frame)\n", stats.objectsOccluded, stats.objectsOccluded / frames);
+	debugPrintf("Pixels updated: avg %u per frame\n", (uint)(stats.tilePixels / frames));
+	debugPrintf("Pixels drawn: avg %u per frame\n", (uint)(stats.drawnPixels / frames));
+	if (stats.tilePixels)
+		debugPrintf("Overdraw: %u.%02u\n", (uint)(stats.drawnPixels / stats.tilePixels), (uint)(stats.drawnPixels * 100 / stats.tilePixels % 100));
+
+	return true;
+}
+
+bool Sword25Console::Cmd_Resources(int argc, const char **argv) {
+	ResourceManager *resources = Kernel::getInstance()->getResourceManager();
+	if (!resources) {
+		debugPrintf("Resource manager not initialized\n");
+		return true;
+	}
+
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		resources->resetCacheStats();
+		debugPrintf("Resource statistics reset\n");
+		return true;
+	}
+
+	const ResourceManager::CacheStats &stats = resources->getCacheStats();
+	debugPrintf("Resources: %u, using %u of %u KB\n", resources->getResourceCount(), resources->getUsedMemory() / 1024, resources->getMaxMemory() / 1024);
+	debugPrintf("Hits: %u, loads: %u, evictions: %u\n", stats.hits, stats.loads, stats.evictions);
+	debugPrintf("Precached: %u, still queued: %u\n", stats.precached, resources->getPrecacheQueueSize());
+
+	return true;
+}
+
 } // End of namespace Sword25
@@ -35,6 +35,10 @@ public:
 	virtual ~Sword25Console(void);
 
 private:
+	bool Cmd_Lua(int argc, const char **argv);
+	bool Cmd_Gfx(int argc, const char **argv);
+	bool Cmd_Resources(int argc, const char **argv);
+
 	Sword25Engine *_vm;
 };
 
@@ -67,6 +67,10 @@ public:
 		return _pImage->getHeight();
 	}
 
+	virtual uint getSize() const {
+		return _pImage ? _pImage->getWidth() * _pImage->getHeight() * 4 : 0;
+	}
+
 	/**
 	    @brief Rendert das Bild in den Framebuffer.
 	    @param PosX die Position auf der X-Achse im Zielbild in Pixeln, an der das Bild gerendert werden soll.<br>
@@ -192,6 +196,11 @@ public:
 		return _pImage->isSolid();
 	}
 
+	Common::Rect getOpaqueRect() {
+		assert(_pImage);
+		return _pImage->getOpaqueRect();
+	}
+
 private:
 	Image *_pImage;
 };
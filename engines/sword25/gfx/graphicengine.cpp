@@ -44,6 +44,7 @@
 #include "sword25/package/packagemanager.h"
 #include "sword25/kernel/inputpersistenceblock.h"
 #include "sword25/kernel/outputpersistenceblock.h"
+#include "sword25/kernel/resmanager.h"
 
 
 #include "sword25/gfx/graphicengine.h"
@@ -61,6 +62,8 @@ enum {
 namespace Sword25 {
 
 static const uint FRAMETIME_SAMPLE_COUNT = 5;       // Frame duration is averaged over FRAMETIME_SAMPLE_COUNT frames
+static const uint PRECACHE_TIME_BUDGET = 5;         // Time in milliseconds spent on loading precached resources after each frame
+static const uint FRAME_TIME_TARGET = 1000 / 60;    // Frame duration in milliseconds, after which no resources are precached
 
 GraphicEngine::GraphicEngine(Kernel *pKernel) :
 	_width(0),
@@ -146,6 +149,13 @@ bool GraphicEngine::endFrame() {
 
 	g_system->updateScreen();
 
+	// Load resources the scripts will need soon, so that they don't have
+	// to be decoded all at once when a room is entered. This only uses the
+	// time left over until the frame target, so slow frames don't get slower.
+	const uint frameTime = Kernel::getInstance()->getMilliTicks() - _lastTimeStamp;
+	if (frameTime < FRAME_TIME_TARGET)
+		Kernel::getInstance()->getResourceManager()->processPrecacheQueue(MIN(PRECACHE_TIME_BUDGET, FRAME_TIME_TARGET - frameTime));
+
 	return true;
 }
 
@@ -145,6 +145,8 @@ public:
 
 	RenderObjectPtr<Panel> getMainPanel();
 
+	RenderObjectManager *getRenderObjectManager() { return _renderObjectManagerPtr.get(); }
+
 	/**
 	 * Specifies the time (in microseconds) since the last frame has passed
 	 */
@@ -34,6 +34,7 @@
 #include "sword25/script/script.h"
 #include "sword25/script/luabindhelper.h"
 #include "sword25/script/luacallback.h"
+#include "sword25/script/luascript.h"
 #include "sword25/math/vertex.h"
 
 #include "sword25/gfx/graphicengine.h"
@@ -252,7 +253,12 @@ static int startFrame(lua_State *L) {
 static int endFrame(lua_State *L) {
 	GraphicEngine *pGE = getGE();
 
-	lua_pushbooleancpp(L, pGE->endFrame());
+	uint renderStart = Kernel::getInstance()->getMilliTicks();
+	bool result = pGE->endFrame();
+	uint renderTime = Kernel::getInstance()->getMilliTicks() - renderStart;
+	static_cast<LuaScriptEngine *>(Kernel::getInstance()->getScript())->frameEnded(L, renderTime);
+
+	lua_pushbooleancpp(L, result);
 
 	return 1;
 }
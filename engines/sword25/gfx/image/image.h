@@ -192,6 +192,12 @@ public:
 
 	virtual bool isSolid() const { return false; }
 
+	/**
+	    @brief Returns a rectangle in image coordinates in which every pixel is fully opaque.
+	    The rectangle is empty if no such area is known.
+	*/
+	virtual Common::Rect getOpaqueRect() const { return Common::Rect(); }
+
 	//@}
 };
 
@@ -100,7 +100,7 @@ static byte *readSavegameThumbnail(const Common::String &filename, uint &fileSiz
 }
 
 RenderedImage::RenderedImage(const Common::String &filename, bool &result) :
-	_isTransparent(true) {
+	_isTransparent(true), _scaledSurface(nullptr) {
 	result = false;
 
 	PackageManager *pPackage = Kernel::getInstance()->getPackage();
@@ -153,7 +153,7 @@ RenderedImage::RenderedImage(const Common::String &filename, bool &result) :
 // -----------------------------------------------------------------------------
 
 RenderedImage::RenderedImage(uint width, uint height, bool &result) :
-	_isTransparent(true) {
+	_isTransparent(true), _scaledSurface(nullptr) {
 
 	_surface.create(width, height, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
 
@@ -165,7 +165,7 @@ RenderedImage::RenderedImage(uint width, uint height, bool &result) :
 	return;
 }
 
-RenderedImage::RenderedImage() : _isTransparent(true) {
+RenderedImage::RenderedImage() : _isTransparent(true), _scaledSurface(nullptr) {
 	_backSurface = Kernel::getInstance()->getGfx()->getSurface();
 
 	_surface.format = Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
@@ -178,6 +178,8 @@ RenderedImage::RenderedImage() : _isTransparent(true) {
 // -----------------------------------------------------------------------------
 
 RenderedImage::~RenderedImage() {
+	invalidateScaledSurface();
+
 	if (_doCleanup) {
 		_surface.free();
 	}
@@ -208,10 +210,14 @@ bool RenderedImage::setContent(const byte *pixeldata, uint size, uint offset, ui
 		in += stride;
 	}
 
+	invalidateScaledSurface();
+
 	return true;
 }
 
 void RenderedImage::replaceContent(byte *pixeldata, int width, int height) {
+	invalidateScaledSurface();
+
 	_surface.w = width;
 	_surface.h = height;
 	_surface.pitch = width * 4;
@@ -227,11 +233,75 @@ uint RenderedImage::getPixel(int x, int y) {
 // -----------------------------------------------------------------------------
 
 bool RenderedImage::blit(int posX, int posY, int flipping, Common::Rect *pPartRect, uint color, int width, int height, RectangleList *updateRects) {
-	_surface.blit(*_backSurface, posX, posY, (((flipping & 1) ? Graphics::FLIP_V : 0) | ((flipping & 2) ? Graphics::FLIP_H : 0)), pPartRect, color, width, height);
+	int flip = (((flipping & 1) ? Graphics::FLIP_V : 0) | ((flipping & 2) ? Graphics::FLIP_H : 0));
+
+	// Work out which part of the image is shown, the same way
+	// TransparentSurface::blit does it
+	Common::Rect srcRect(0, 0, _surface.w, _surface.h);
+	if (pPartRect) {
+		srcRect = Common::Rect(pPartRect->width(), pPartRect->height());
+		srcRect.moveTo((flip & Graphics::FLIP_H) ? _surface.w - pPartRect->right : pPartRect->left,
+		               (flip & Graphics::FLIP_V) ? _surface.h - pPartRect->bottom : pPartRect->top);
+	}
+
+	if (width == -1)
+		width = srcRect.width();
+	if (height == -1)
+		height = srcRect.height();
+
+	if ((color >> 24) == 0)
+		return true;
+
+	Graphics::TransparentSurface *src = &_surface;
+	Common::Rect *partRect = pPartRect;
+	if (width != srcRect.width() || height != srcRect.height()) {
+		src = getScaledSurface(srcRect, width, height);
+		partRect = nullptr;
+	}
+
+	if (!updateRects) {
+		src->blit(*_backSurface, posX, posY, flip, partRect, color, width, height);
+		return true;
+	}
+
+	// Only touch the parts of the back buffer which are redrawn in this
+	// frame, everything else already holds the final image
+	const Common::Rect screenRect(_backSurface->w, _backSurface->h);
+	const Common::Rect destRect(posX, posY, posX + width, posY + height);
+	for (RectangleList::iterator it = updateRects->begin(); it != updateRects->end(); ++it) {
+		Common::Rect clipRect = destRect.findIntersectingRect(*it);
+		clipRect.clip(screenRect);
+		if (clipRect.isEmpty())
+			continue;
+
+		src->blitClip(*_backSurface, clipRect, posX, posY, flip, partRect, color, width, height);
+	}
 
 	return true;
 }
 
+Graphics::TransparentSurface *RenderedImage::getScaledSurface(const Common::Rect &srcRect, int width, int height) {
+	if (_scaledSurface && _scaledSrcRect == srcRect && _scaledSurface->w == width && _scaledSurface->h == height)
+		return _scaledSurface;
+
+	invalidateScaledSurface();
+
+	Graphics::TransparentSurface part(_surface.getSubArea(srcRect), false);
+	_scaledSurface = part.scale(width, height);
+	_scaledSurface->setAlphaMode(_surface.getAlphaMode());
+	_scaledSrcRect = srcRect;
+
+	return _scaledSurface;
+}
+
+void RenderedImage::invalidateScaledSurface() {
+	if (_scaledSurface) {
+		_scaledSurface->free();
+		delete _scaledSurface;
+		_scaledSurface = nullptr;
+	}
+}
+
 void RenderedImage::copyDirectly(int posX, int posY) {
 	byte *data = (byte *)_surface.getPixels();
 	int w = _surface.w;
@@ -263,11 +333,50 @@ void RenderedImage::checkForTransparency() {
 	for (int i = 0; i < _surface.h; i++) {
 		for (int j = 0; j < _surface.w; j++) {
 			_isTransparent = data[3] != 0xff;
-			if (_isTransparent)
+			if (_isTransparent) {
+				findOpaqueRect();
 				return;
+			}
 			data += 4;
 		}
 	}
 }
 
+void RenderedImage::findOpaqueRect() {
+	// Find the largest rectangle of fully opaque pixels. Every row is
+	// treated as a histogram of the opaque run lengths ending in it, and the
+	// largest rectangle under the histogram is found with a stack of
+	// increasing heights.
+	_opaqueRect = Common::Rect();
+
+	const int w = _surface.w;
+	Common::Array<int> heights;
+	Common::Array<int> stack;
+	heights.resize(w + 1);
+	stack.reserve(w + 1);
+	for (int x = 0; x <= w; x++)
+		heights[x] = 0;
+
+	int bestArea = 0;
+	for (int y = 0; y < _surface.h; y++) {
+		const byte *data = (const byte *)_surface.getBasePtr(0, y);
+		for (int x = 0; x < w; x++, data += 4)
+			heights[x] = (data[3] == 0xff) ? heights[x] + 1 : 0;
+
+		stack.clear();
+		for (int x = 0; x <= w; x++) {
+			while (!stack.empty() && heights[stack.back()] >= heights[x]) {
+				const int height = heights[stack.back()];
+				stack.pop_back();
+				const int left = stack.empty() ? 0 : stack.back() + 1;
+				if (height * (x - left) > bestArea) {
+					bestArea = height * (x - left);
+					_opaqueRect = Common::Rect(left, y + 1 - height, x, y + 1);
+				}
+			}
+			stack.push_back(x);
+		}
+	}
+}
+
 } // End of namespace Sword25
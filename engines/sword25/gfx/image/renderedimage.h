@@ -110,15 +110,30 @@ public:
 
 	void setIsTransparent(bool isTransparent) { _isTransparent = isTransparent; }
 	virtual bool isSolid() const { return !_isTransparent; }
+	virtual Common::Rect getOpaqueRect() const {
+		return _isTransparent ? _opaqueRect : Common::Rect(_surface.w, _surface.h);
+	}
 
 private:
 	Graphics::TransparentSurface _surface;
 	bool _doCleanup;
 	bool _isTransparent;
 
+	// Largest fully opaque area of a transparent image, used to skip
+	// drawing objects that are hidden behind it
+	Common::Rect _opaqueRect;
+
 	Graphics::Surface *_backSurface;
 
+	// Scaled copy of the last part of the image that was blitted with a
+	// different size, so that zoomed sprites are not rescaled every frame
+	Graphics::TransparentSurface *_scaledSurface;
+	Common::Rect _scaledSrcRect;
+
 	void checkForTransparency();
+	void findOpaqueRect();
+	void invalidateScaledSurface();
+	Graphics::TransparentSurface *getScaledSurface(const Common::Rect &srcRect, int width, int height);
 };
 
 } // End of namespace Sword25
@@ -128,31 +128,12 @@ void RenderObject::preRender(RenderObjectQueue *renderQueue) {
 
 }
 
-bool RenderObject::render(RectangleList *updateRects, const Common::Array<int> &updateRectsMinZ) {
-
+bool RenderObject::render(RectangleList *updateRects) {
 	// Falls das Objekt nicht sichtbar ist, muss gar nichts gezeichnet werden
 	if (!_visible)
 		return true;
 
-	// Objekt zeichnen.
-	bool needRender = false;
-	int index = 0;
-
-	// Only draw if the bounding box intersects any update rectangle and
-	// the object is in front of the minimum Z value.
-	for (RectangleList::iterator rectIt = updateRects->begin(); !needRender && rectIt != updateRects->end(); ++rectIt, ++index)
-		needRender = (_bbox.contains(*rectIt) || _bbox.intersects(*rectIt)) && getAbsoluteZ() >= updateRectsMinZ[index];
-
-	if (needRender)
-		doRender(updateRects);
-
-	// Draw all children
-	RENDEROBJECT_ITER it = _children.begin();
-	for (; it != _children.end(); ++it)
-		if (!(*it)->render(updateRects, updateRectsMinZ))
-			return false;
-
-	return true;
+	return doRender(updateRects);
 }
 
 void RenderObject::validateObject() {
@@ -217,13 +217,13 @@ public:
 	void preRender(RenderObjectQueue *renderQueue);
 
 	/**
-	    @brief Rendert des Objekt und alle seine Unterobjekte.
+	    @brief Rendert das Objekt, beschrnkt auf die bergebenen Update-Rects. Unterobjekte werden nicht gezeichnet.
 	    @return Gibt false zurck, falls beim Rendern ein Fehler aufgetreten ist.
-	    @remark Vor jedem Aufruf dieser Methode muss ein Aufruf von UpdateObjectState() erfolgt sein.
-	            Dieses kann entweder direkt geschehen oder durch den Aufruf von UpdateObjectState() an einem Vorfahren-Objekt.<br>
+	    @remark Vor jedem Aufruf dieser Methode muss ein Aufruf von PreRender() erfolgt sein, der das Objekt in die
+	            Renderreihenfolge eingereiht hat.<br>
 	            Diese Methode darf nur von BS_RenderObjectManager aufgerufen werden.
 	*/
-	bool render(RectangleList *updateRects, const Common::Array<int> &updateRectsMinZ);
+	bool render(RectangleList *updateRects);
 
 	/**
 	    @brief Bereitet das Objekt und alle seine Unterobjekte auf einen Rendervorgang vor.
@@ -372,6 +372,14 @@ public:
 		return _isSolid;
 	}
 
+	/**
+	    @brief Returns the area of the object in screen coordinates in which every drawn pixel is fully opaque.
+	    Objects drawn before this one are hidden in this area and don't need to be drawn there.
+	*/
+	virtual Common::Rect getOpaqueBbox() const {
+		return _isSolid ? _bbox : Common::Rect();
+	}
+
 	// Persistenz-Methoden
 	// -------------------
 	virtual bool persist(OutputPersistenceBlock &writer);
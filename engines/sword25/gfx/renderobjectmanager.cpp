@@ -65,6 +65,7 @@ RenderObjectManager::RenderObjectManager(int width, int height, int framebufferC
 	_uta = new MicroTileArray(width, height);
 	_currQueue = new RenderObjectQueue();
 	_prevQueue = new RenderObjectQueue();
+	resetRenderStats();
 }
 
 RenderObjectManager::~RenderObjectManager() {
@@ -116,26 +117,71 @@ bool RenderObjectManager::render() {
 	}
 
 	RectangleList *updateRects = _uta->getRectangles();
-	Common::Array<int> updateRectsMinZ;
 
-	updateRectsMinZ.reserve(updateRects->size());
+	// The update rectangles don't overlap, so each of them can be composed on its own.
+	// For every rectangle find the front-most object which covers it completely with
+	// opaque pixels. All objects queued before it would be overdrawn again and so don't
+	// need to be drawn there in the first place.
+	Common::Array<Common::Rect> tiles;
+	Common::Array<uint> tileFirstObject;
+	tiles.reserve(updateRects->size());
+	tileFirstObject.reserve(updateRects->size());
+
+	Common::Array<RenderObject *> drawList;
+	Common::Array<Common::Rect> opaqueBboxes;
+	for (RenderObjectQueue::iterator it = _currQueue->begin(); it != _currQueue->end(); ++it) {
+		drawList.push_back((*it)._renderObject);
+		opaqueBboxes.push_back((*it)._renderObject->getOpaqueBbox());
+	}
 
-	// Calculate the minimum drawing Z value of each update rectangle
-	// Solid bitmaps with a Z order less than the value calculated here would be overdrawn again and
-	// so don't need to be drawn in the first place which speeds things up a bit.
 	for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
-		int minZ = 0;
-		for (RenderObjectQueue::iterator it = _currQueue->reverse_begin(); it != _currQueue->end(); --it) {
-			if ((*it)._renderObject->isVisible() && (*it)._renderObject->isSolid() &&
-				(*it)._renderObject->getBbox().contains(*rectIt)) {
-				minZ = (*it)._renderObject->getAbsoluteZ();
+		uint first = 0;
+		for (uint i = drawList.size(); i > 0; --i) {
+			if (opaqueBboxes[i - 1].contains(*rectIt)) {
+				first = i - 1;
 				break;
 			}
 		}
-		updateRectsMinZ.push_back(minZ);
+		tiles.push_back(*rectIt);
+		tileFirstObject.push_back(first);
+		_renderStats.tilePixels += (*rectIt).width() * (*rectIt).height();
 	}
 
-	if (_rootPtr->render(updateRects, updateRectsMinZ)) {
+	// Draw the objects in queue order. Every object is drawn once, clipped to those
+	// rectangles in which it is visible.
+	bool result = true;
+	RectangleList objectTiles;
+	for (uint i = 0; i < drawList.size(); ++i) {
+		const Common::Rect &bbox = drawList[i]->getBbox();
+		objectTiles.clear();
+		for (uint t = 0; t < tiles.size(); ++t) {
+			if (!bbox.intersects(tiles[t]))
+				continue;
+
+			if (i < tileFirstObject[t]) {
+				++_renderStats.objectsOccluded;
+				continue;
+			}
+
+			objectTiles.push_back(tiles[t]);
+			const Common::Rect drawnRect = bbox.findIntersectingRect(tiles[t]);
+			_renderStats.drawnPixels += drawnRect.width() * drawnRect.height();
+		}
+
+		if (objectTiles.empty())
+			continue;
+
+		++_renderStats.objectsDrawn;
+		if (!drawList[i]->render(&objectTiles)) {
+			result = false;
+			break;
+		}
+	}
+
+	++_renderStats.frames;
+	_renderStats.tiles += tiles.size();
+
+	if (result) {
 		// Copy updated rectangles to the video screen
 		Graphics::Surface *backSurface = Kernel::getInstance()->getGfx()->getSurface();
 		for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
@@ -154,6 +200,15 @@ bool RenderObjectManager::render() {
 	return true;
 }
 
+void RenderObjectManager::resetRenderStats() {
+	_renderStats.frames = 0;
+	_renderStats.tiles = 0;
+	_renderStats.objectsDrawn = 0;
+	_renderStats.objectsOccluded = 0;
+	_renderStats.tilePixels = 0;
+	_renderStats.drawnPixels = 0;
+}
+
 void RenderObjectManager::attatchTimedRenderObject(RenderObjectPtr<TimedRenderObject> renderObjectPtr) {
 	_timedRenderObjects.push_back(renderObjectPtr);
 }
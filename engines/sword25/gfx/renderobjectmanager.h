@@ -126,6 +126,23 @@ public:
 	virtual bool persist(OutputPersistenceBlock &writer);
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
+	/**
+	    @brief Statistics about the rendered frames, summed up since the last call of resetRenderStats().
+	*/
+	struct RenderStats {
+		uint32 frames;
+		uint32 tiles;           ///< Number of update rectangles
+		uint32 objectsDrawn;    ///< Number of objects drawn into the update rectangles
+		uint32 objectsOccluded; ///< Number of objects skipped, because they were hidden by opaque objects
+		uint64 tilePixels;      ///< Area of all update rectangles
+		uint64 drawnPixels;     ///< Area drawn by all objects, the ratio to tilePixels is the overdraw
+	};
+
+	const RenderStats &getRenderStats() const {
+		return _renderStats;
+	}
+	void resetRenderStats();
+
 private:
 	bool _frameStarted;
 	typedef Common::Array<RenderObjectPtr<TimedRenderObject> > RenderObjectList;
@@ -134,6 +151,8 @@ private:
 	MicroTileArray *_uta;
 	RenderObjectQueue *_currQueue, *_prevQueue;
 
+	RenderStats _renderStats;
+
 	// RenderObject-Tree Variablen
 	// ---------------------------
 	// Der Baum legt die hierachische Ordnung der BS_RenderObjects fest.
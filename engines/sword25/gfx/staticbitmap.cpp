@@ -65,7 +65,7 @@ bool StaticBitmap::initBitmapResource(const Common::String &filename) {
 
 	BitmapResource *bitmapPtr = static_cast<BitmapResource *>(resourcePtr);
 
-	// Den eindeutigen Dateinamen zum spteren Referenzieren speichern
+	// Den eindeutigen Dateinamen zum sp�teren Referenzieren speichern
 	_resourceFilename = bitmapPtr->getFileName();
 
 	// RenderObject Eigenschaften aktualisieren
@@ -73,6 +73,7 @@ bool StaticBitmap::initBitmapResource(const Common::String &filename) {
 	_originalHeight = _height = bitmapPtr->getHeight();
 
 	_isSolid = bitmapPtr->isSolid();
+	_opaqueRect = bitmapPtr->getOpaqueRect();
 
 	// Bild-Resource freigeben
 	bitmapPtr->release();
@@ -116,6 +117,42 @@ bool StaticBitmap::doRender(RectangleList *updateRects) {
 	return result;
 }
 
+Common::Rect StaticBitmap::getOpaqueBbox() const {
+	// With a translucent modulation colour the objects behind shine through
+	if ((_modulationColor >> 24) != 0xff || _opaqueRect.isEmpty())
+		return Common::Rect();
+
+	Common::Rect rect = _opaqueRect;
+	if (_flipH) {
+		rect.left = _originalWidth - _opaqueRect.right;
+		rect.right = _originalWidth - _opaqueRect.left;
+	}
+	if (_flipV) {
+		rect.top = _originalHeight - _opaqueRect.bottom;
+		rect.bottom = _originalHeight - _opaqueRect.top;
+	}
+
+	if (_width != _originalWidth || _height != _originalHeight) {
+		// Round inwards, so that the scaled rectangle stays inside the opaque area
+		rect.left = (rect.left * _width + _originalWidth - 1) / _originalWidth;
+		rect.right = rect.right * _width / _originalWidth;
+		rect.top = (rect.top * _height + _originalHeight - 1) / _originalHeight;
+		rect.bottom = rect.bottom * _height / _originalHeight;
+		if (rect.isEmpty())
+			return Common::Rect();
+	}
+
+	rect.translate(_absoluteX, _absoluteY);
+
+	// The bitmap is only drawn inside its bounding box, which is clipped to
+	// the parent, so it can't hide anything outside of it
+	rect.clip(_bbox);
+	if (rect.isEmpty())
+		return Common::Rect();
+
+	return rect;
+}
+
 uint StaticBitmap::getPixel(int x, int y) const {
 	assert(x >= 0 && x < _width);
 	assert(y >= 0 && y < _height);
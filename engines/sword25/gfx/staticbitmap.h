@@ -61,6 +61,8 @@ public:
 		return false;
 	}
 
+	virtual Common::Rect getOpaqueBbox() const;
+
 	virtual bool persist(OutputPersistenceBlock &writer);
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
@@ -69,6 +71,7 @@ protected:
 
 private:
 	Common::String _resourceFilename;
+	Common::Rect _opaqueRect;
 
 	bool initBitmapResource(const Common::String &filename);
 };
@@ -131,7 +131,7 @@ static int getSubversionRevision(lua_State *L) {
 static int getUsedMemory(lua_State *L) {
 	// It doesn't really matter what this call returns,
 	// as it's used in a debug function.
-	lua_pushnumber(L, 0);
+	lua_pushnumber(L, Kernel::getInstance()->getResourceManager()->getUsedMemory());
 	return 1;
 }
 
@@ -313,6 +313,7 @@ static int precacheResource(lua_State *L) {
 #ifdef PRECACHE_RESOURCES
 	lua_pushbooleancpp(L, pResource->precacheResource(luaL_checkstring(L, 1)));
 #else
+	pResource->queuePrecache(luaL_checkstring(L, 1));
 	lua_pushbooleancpp(L, true);
 #endif
 
@@ -328,6 +329,7 @@ static int forcePrecacheResource(lua_State *L) {
 #ifdef PRECACHE_RESOURCES
 	lua_pushbooleancpp(L, pResource->precacheResource(luaL_checkstring(L, 1), true));
 #else
+	pResource->queuePrecache(luaL_checkstring(L, 1));
 	lua_pushbooleancpp(L, true);
 #endif
 
@@ -341,8 +343,7 @@ static int getMaxMemoryUsage(lua_State *L) {
 	assert(pResource);
 
 	// This is used for debugging, so it doesn't really matter.
-	// The default value set by the scripts is 256000000 bytes
-	lua_pushnumber(L, 256000000);
+	lua_pushnumber(L, pResource->getMaxMemory());
 
 	return 1;
 }
@@ -353,8 +354,8 @@ static int setMaxMemoryUsage(lua_State *L) {
 	ResourceManager *pResource = pKernel->getResourceManager();
 	assert(pResource);
 
-	// This call is ignored, we set a limit on the number of
-	// simultaneous resources loaded instead.
+	// This call is ignored. The scripts set 256000000 bytes, the
+	// budget is set with the "resource_cache_size" config key instead.
 
 	return 0;
 }
@@ -35,18 +35,37 @@
 #include "sword25/kernel/resservice.h"
 #include "sword25/package/packagemanager.h"
 
+#include "common/config-manager.h"
+
 namespace Sword25 {
 
-// Sets the amount of resources that are simultaneously loaded.
-// This needs to be a relatively high number, as all the animation
-// frames in each scene are loaded as separate resources.
-// Also, George's walk states are all loaded here (150 files)
+// The default amount of memory in KB used by the cached resources. This
+// needs to be a relatively high number, as all the animation frames in
+// each scene are loaded as separate resources. Also, George's walk states
+// are all loaded here (150 files). Can be changed with the
+// "resource_cache_size" config key.
+#define SWORD25_RESOURCECACHE_DEFAULT_SIZE (96 * 1024)
+// If the memory budget is exceeded, the resource manager will start purging
+// resources until this percentage of the budget is in use
+#define SWORD25_RESOURCECACHE_LOW_WATERMARK 80
+// The maximum number of loaded resources. Sounds, scripts and XML data are
+// not counted against the memory budget, so the number of resources is
+// limited as well. If more than these resources are loaded, the resource
+// manager will start purging resources till it hits the minimum limit
 #define SWORD25_RESOURCECACHE_MIN 400
-// The maximum number of loaded resources. If more than these resources
-// are loaded, the resource manager will start purging resources till it
-// hits the minimum limit above
 #define SWORD25_RESOURCECACHE_MAX 500
 
+ResourceManager::ResourceManager(Kernel *pKernel) :
+	_kernelPtr(pKernel),
+	_usedMemory(0) {
+	int cacheSize = SWORD25_RESOURCECACHE_DEFAULT_SIZE;
+	if (ConfMan.hasKey("resource_cache_size"))
+		cacheSize = MAX(ConfMan.getInt("resource_cache_size"), 1024);
+	_maxMemory = cacheSize * 1024;
+
+	resetCacheStats();
+}
+
 ResourceManager::~ResourceManager() {
 	// Clear all unlocked resources
 	emptyCache();
@@ -85,12 +104,15 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
 /**
  * Deletes resources as necessary until the specified memory limit is not being exceeded.
  */
-void ResourceManager::deleteResourcesIfNecessary() {
+void ResourceManager::deleteResourcesIfNecessary(uint neededMemory) {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if ((_usedMemory + neededMemory <= _maxMemory && _resources.size() < SWORD25_RESOURCECACHE_MAX) || _resources.empty())
 		return;
 
-	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
+	const uint lowWatermark = _maxMemory / 100 * SWORD25_RESOURCECACHE_LOW_WATERMARK;
+
+	// Keep deleting resources until the memory usage falls below the low watermark
+	// and the number of resources below the minimum limit.
 	// The list is processed backwards in order to first release those resources that have been
 	// not been accessed for the longest
 	Common::List<Resource *>::iterator iter = _resources.end();
@@ -98,16 +120,19 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		--iter;
 
 		// The resource may be released only if it isn't locked
-		if ((*iter)->getLockCount() == 0)
+		if ((*iter)->getLockCount() == 0) {
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+			++_cacheStats.evictions;
+		}
+	} while (iter != _resources.begin() &&
+	         (_usedMemory + neededMemory > lowWatermark || _resources.size() >= SWORD25_RESOURCECACHE_MIN));
 
-	// Are we still above the minimum? If yes, then start releasing locked resources
+	// Are we still above the budget? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
 	// in the resource lock code, and resources are not unlocked when changing rooms.
 	// Only image/animation resources are unlocked forcibly, thus this shouldn't have
 	// any impact on the game itself.
-	if (_resources.size() <= SWORD25_RESOURCECACHE_MIN)
+	if (_resources.empty() || (_usedMemory + neededMemory <= _maxMemory && _resources.size() <= SWORD25_RESOURCECACHE_MIN))
 		return;
 
 	iter = _resources.end();
@@ -125,8 +150,10 @@ void ResourceManager::deleteResourcesIfNecessary() {
 				(*iter)->release();
 
 			iter = deleteResource(*iter);
+			++_cacheStats.evictions;
 		}
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() &&
+	         (_usedMemory + neededMemory > lowWatermark || _resources.size() >= SWORD25_RESOURCECACHE_MIN));
 }
 
 /**
@@ -164,16 +191,30 @@ void ResourceManager::emptyThumbnailCache() {
  * @param FileName      Filename of resource
  */
 Resource *ResourceManager::requestResource(const Common::String &fileName) {
-	// Get the absolute path to the file
-	Common::String uniqueFileName = getUniqueFileName(fileName);
-	if (uniqueFileName.empty())
-		return NULL;
+	// Render objects request their resources every frame using the absolute
+	// path they got from the resource. These are found without building the
+	// absolute path again.
+	Resource *pResource = 0;
+	if (fileName.hasPrefix("/"))
+		pResource = getResource(fileName);
+
+	if (!pResource) {
+		// Get the absolute path to the file
+		Common::String uniqueFileName = getUniqueFileName(fileName);
+		if (uniqueFileName.empty())
+			return NULL;
+
+		// Determine whether the resource is already loaded
+		pResource = getResource(uniqueFileName);
+		if (!pResource)
+			pResource = loadResource(uniqueFileName);
+		else
+			++_cacheStats.hits;
+	} else {
+		++_cacheStats.hits;
+	}
 
-	// Determine whether the resource is already loaded
 	// If the resource is found, it will be placed at the head of the resource list and returned
-	Resource *pResource = getResource(uniqueFileName);
-	if (!pResource)
-		pResource = loadResource(uniqueFileName);
 	if (pResource) {
 		moveToFront(pResource);
 		(pResource)->addReference();
@@ -220,6 +261,46 @@ bool ResourceManager::precacheResource(const Common::String &fileName, bool forc
 
 #endif
 
+void ResourceManager::queuePrecache(const Common::String &fileName) {
+	// The path has to be resolved now, as the current directory may change until it is loaded
+	Common::String uniqueFileName = getUniqueFileName(fileName);
+	if (uniqueFileName.empty() || getResource(uniqueFileName) || _precacheSet.contains(uniqueFileName))
+		return;
+
+	_precacheQueue.push_back(uniqueFileName);
+	_precacheSet[uniqueFileName] = true;
+}
+
+void ResourceManager::processPrecacheQueue(uint timeBudget) {
+	if (_precacheQueue.empty())
+		return;
+
+	PackageManager *pPackage = _kernelPtr->getPackage();
+	const uint startTime = _kernelPtr->getMilliTicks();
+	do {
+		Common::String fileName = _precacheQueue.front();
+		_precacheQueue.pop_front();
+		_precacheSet.erase(fileName);
+
+		// The resource may have been requested in the meantime. Missing
+		// files are skipped here, as failing to load them is fatal.
+		if (getResource(fileName) || !pPackage->fileExists(fileName))
+			continue;
+
+		if (loadResource(fileName)) {
+			++_cacheStats.precached;
+			debugC(kDebugResource, "Precached \"%s\"", fileName.c_str());
+		}
+	} while (!_precacheQueue.empty() && _kernelPtr->getMilliTicks() - startTime < timeBudget);
+}
+
+void ResourceManager::resetCacheStats() {
+	_cacheStats.hits = 0;
+	_cacheStats.loads = 0;
+	_cacheStats.precached = 0;
+	_cacheStats.evictions = 0;
+}
+
 /**
  * Moves a resource to the top of the resource list
  * @param pResource     The resource
@@ -243,9 +324,6 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 	// ResourceService finden, der die Resource laden kann.
 	for (uint i = 0; i < _resourceServices.size(); ++i) {
 		if (_resourceServices[i]->canLoadResource(fileName)) {
-			// If more memory is desired, memory must be released
-			deleteResourcesIfNecessary();
-
 			// Load the resource
 			Resource *pResource = _resourceServices[i]->loadResource(fileName);
 			if (!pResource) {
@@ -253,6 +331,13 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 				return NULL;
 			}
 
+			// If more memory is desired, memory must be released. This is done after
+			// loading, as loading may request other resources which must not be purged.
+			pResource->_size = pResource->getSize();
+			deleteResourcesIfNecessary(pResource->_size);
+			_usedMemory += pResource->_size;
+			++_cacheStats.loads;
+
 			// Add the resource to the front of the list
 			_resources.push_front(pResource);
 			pResource->_iterator = _resources.begin();
@@ -296,6 +381,8 @@ Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pRe
 	// Remove the resource from the hash table
 	_resourceHashMap.erase(pResource->_fileName);
 
+	_usedMemory -= pResource->_size;
+
 	// Delete the resource from the resource list
 	Common::List<Resource *>::iterator result = _resources.erase(pResource->_iterator);
 
@@ -88,14 +88,59 @@ public:
 	 */
 	void dumpLockedResources();
 
+	/**
+	 * Queues a resource to be loaded in the spare time at the end of the following frames
+	 * @param FileName      The filename of the resource
+	 */
+	void queuePrecache(const Common::String &fileName);
+
+	/**
+	 * Loads queued resources until the given time has been spent.
+	 * At least one resource is loaded, if any are queued.
+	 * @param TimeBudget    The time in milliseconds that may be spent loading
+	 */
+	void processPrecacheQueue(uint timeBudget);
+
+	/**
+	 * Returns the memory used by the cached resources in bytes
+	 */
+	uint getUsedMemory() const {
+		return _usedMemory;
+	}
+
+	/**
+	 * Returns the memory budget of the cache in bytes
+	 */
+	uint getMaxMemory() const {
+		return _maxMemory;
+	}
+
+	struct CacheStats {
+		uint hits;
+		uint loads;
+		uint precached;
+		uint evictions;
+	};
+
+	const CacheStats &getCacheStats() const {
+		return _cacheStats;
+	}
+	void resetCacheStats();
+
+	uint getResourceCount() const {
+		return _resources.size();
+	}
+
+	uint getPrecacheQueueSize() const {
+		return _precacheQueue.size();
+	}
+
 private:
 	/**
 	 * Creates a new resource manager
 	 * Only the BS_Kernel class can generate copies this class. Thus, the constructor is private
 	 */
-	ResourceManager(Kernel *pKernel) :
-		_kernelPtr(pKernel)
-	{}
+	ResourceManager(Kernel *pKernel);
 	virtual ~ResourceManager();
 
 	/**
@@ -131,14 +176,23 @@ private:
 
 	/**
 	 * Deletes resources as necessary until the specified memory limit is not being exceeded.
+	 * @param NeededMemory  The size of the resource which is about to be loaded
 	 */
-	void deleteResourcesIfNecessary();
+	void deleteResourcesIfNecessary(uint neededMemory);
 
 	Kernel *_kernelPtr;
 	Common::Array<ResourceService *> _resourceServices;
 	Common::List<Resource *> _resources;
 	typedef Common::HashMap<Common::String, Resource *> ResMap;
 	ResMap _resourceHashMap;
+
+	uint _usedMemory;
+	uint _maxMemory;
+	CacheStats _cacheStats;
+
+	Common::List<Common::String> _precacheQueue;
+	typedef Common::HashMap<Common::String, bool> PrecacheSet;
+	PrecacheSet _precacheSet;
 };
 
 } // End of namespace Sword25
@@ -92,6 +92,13 @@ public:
 		return _type;
 	}
 
+	/**
+	 * Returns the approximate amount of memory used by the resource in bytes
+	 */
+	virtual uint getSize() const {
+		return 0;
+	}
+
 protected:
 	virtual ~Resource() {}
 
@@ -99,6 +106,7 @@ private:
 	Common::String _fileName;          ///< The absolute filename
 	uint _refCount;          ///< The number of locks
 	uint _type;              ///< The type of the resource
+	uint _size;              ///< The size accounted for the resource in the cache
 	Common::List<Resource *>::iterator _iterator;        ///< Points to the resource position in the LRU list
 };
 
@@ -48,6 +48,7 @@ MODULE_OBJS := \
 	math/walkregion.o \
 	package/packagemanager.o \
 	package/packagemanager_script.o \
+	script/luaallocator.o \
 	script/luabindhelper.o \
 	script/luacallback.o \
 	script/luascript.o \
@@ -0,0 +1,162 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "sword25/script/luaallocator.h"
+
+namespace Sword25 {
+
+LuaAllocator::LuaAllocator() :
+	_chunkPos(0),
+	_chunkLeft(0),
+	_usedBytes(0),
+	_poolAllocations(0),
+	_systemAllocations(0) {
+	for (uint i = 0; i < kNumClasses; ++i)
+		_freeLists[i] = 0;
+}
+
+LuaAllocator::~LuaAllocator() {
+	for (uint i = 0; i < _chunks.size(); ++i)
+		free(_chunks[i]);
+	for (uint i = 0; i < _adoptedBlocks.size(); ++i)
+		free(_adoptedBlocks[i]);
+}
+
+void *LuaAllocator::alloc(void *ud, void *ptr, size_t osize, size_t nsize) {
+	return static_cast<LuaAllocator *>(ud)->reallocate(ptr, osize, nsize);
+}
+
+void LuaAllocator::resetStats() {
+	_poolAllocations = 0;
+	_systemAllocations = 0;
+}
+
+void *LuaAllocator::reallocate(void *ptr, size_t osize, size_t nsize) {
+	if (nsize == 0) {
+		if (ptr)
+			freeBlock(ptr, osize);
+		return 0;
+	}
+
+	if (!ptr)
+		return allocateBlock(nsize);
+
+	bool oldPooled = osize <= kMaxPooledSize;
+	bool newPooled = nsize <= kMaxPooledSize;
+
+	if (!oldPooled && !newPooled) {
+		void *block = realloc(ptr, nsize);
+		if (block) {
+			_usedBytes = _usedBytes - osize + nsize;
+			++_systemAllocations;
+		}
+		return block;
+	}
+
+	if (oldPooled && newPooled && getClass(osize) == getClass(nsize)) {
+		// Still fits into the same block
+		_usedBytes = _usedBytes - osize + nsize;
+		return ptr;
+	}
+
+	// Lua expects the old block to stay valid if this fails
+	void *block = allocateBlock(nsize);
+	if (!block) {
+		// Lua 5.1 assumes that shrinking a block never fails. The old block
+		// is at least as large, so keep using it. When it's freed, it goes
+		// to the free list of the new size, which it is large enough for.
+		// A block from malloc() then belongs to the pools, which only free
+		// their chunks, so remember it to be freed along with them.
+		if (nsize <= osize) {
+			if (!oldPooled)
+				_adoptedBlocks.push_back(ptr);
+			_usedBytes = _usedBytes - osize + nsize;
+			return ptr;
+		}
+		return 0;
+	}
+	memcpy(block, ptr, MIN(osize, nsize));
+	freeBlock(ptr, osize);
+	return block;
+}
+
+void *LuaAllocator::allocateBlock(size_t size) {
+	if (size > kMaxPooledSize) {
+		void *block = malloc(size);
+		if (block) {
+			_usedBytes += size;
+			++_systemAllocations;
+		}
+		return block;
+	}
+
+	uint sizeClass = getClass(size);
+	FreeBlock *block = _freeLists[sizeClass];
+	if (block) {
+		_freeLists[sizeClass] = block->next;
+	} else {
+		size_t blockSize = (sizeClass + 1) * kGranularity;
+		if (_chunkLeft < blockSize) {
+			// The rest of the current chunk is too small, hand it out to the
+			// smaller classes so it isn't wasted
+			while (_chunkLeft >= kGranularity) {
+				uint restClass = getClass(_chunkLeft);
+				size_t restSize = (restClass + 1) * kGranularity;
+				FreeBlock *rest = reinterpret_cast<FreeBlock *>(_chunkPos);
+				rest->next = _freeLists[restClass];
+				_freeLists[restClass] = rest;
+				_chunkPos += restSize;
+				_chunkLeft -= restSize;
+			}
+
+			byte *chunk = static_cast<byte *>(malloc(kChunkSize));
+			if (!chunk)
+				return 0;
+			_chunks.push_back(chunk);
+			_chunkPos = chunk;
+			_chunkLeft = kChunkSize;
+		}
+		block = reinterpret_cast<FreeBlock *>(_chunkPos);
+		_chunkPos += blockSize;
+		_chunkLeft -= blockSize;
+	}
+
+	_usedBytes += size;
+	++_poolAllocations;
+	return block;
+}
+
+void LuaAllocator::freeBlock(void *ptr, size_t size) {
+	_usedBytes -= size;
+
+	if (size > kMaxPooledSize) {
+		free(ptr);
+		return;
+	}
+
+	uint sizeClass = getClass(size);
+	FreeBlock *block = static_cast<FreeBlock *>(ptr);
+	block->next = _freeLists[sizeClass];
+	_freeLists[sizeClass] = block;
+}
+
+} // End of namespace Sword25
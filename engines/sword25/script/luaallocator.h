@@ -0,0 +1,90 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef SWORD25_LUAALLOCATOR_H
+#define SWORD25_LUAALLOCATOR_H
+
+#include "common/array.h"
+#include "sword25/kernel/common.h"
+
+namespace Sword25 {
+
+/**
+ * Memory allocator for the Lua state.
+ *
+ * Most of Lua's allocations are small (strings, table nodes, closures,
+ * upvalues) and short-lived. These are served from free lists, one per size
+ * class, which are carved out of larger chunks. Lua tells the allocator the
+ * size of every block it frees, so no per-block header is needed. Chunks are
+ * only given back to the system when the allocator is destroyed, after the
+ * state has been closed. Larger blocks go straight to malloc().
+ */
+class LuaAllocator {
+public:
+	LuaAllocator();
+	~LuaAllocator();
+
+	/**
+	 * The lua_Alloc callback, the user data must point to a LuaAllocator.
+	 */
+	static void *alloc(void *ud, void *ptr, size_t osize, size_t nsize);
+
+	uint32 getUsedBytes() const { return _usedBytes; }
+	uint32 getChunkBytes() const { return _chunks.size() * kChunkSize; }
+	uint32 getPoolAllocations() const { return _poolAllocations; }
+	uint32 getSystemAllocations() const { return _systemAllocations; }
+	void resetStats();
+
+private:
+	enum {
+		kGranularity = 8,
+		kMaxPooledSize = 256,
+		kNumClasses = kMaxPooledSize / kGranularity,
+		kChunkSize = 64 * 1024
+	};
+
+	struct FreeBlock {
+		FreeBlock *next;
+	};
+
+	static uint getClass(size_t size) { return (size - 1) / kGranularity; }
+
+	void *reallocate(void *ptr, size_t osize, size_t nsize);
+	void *allocateBlock(size_t size);
+	void freeBlock(void *ptr, size_t size);
+
+	FreeBlock *_freeLists[kNumClasses];
+	Common::Array<byte *> _chunks;
+	// Blocks from malloc() which were shrunk into a size class and are
+	// now part of the pools
+	Common::Array<void *> _adoptedBlocks;
+	byte *_chunkPos;
+	size_t _chunkLeft;
+
+	uint32 _usedBytes;
+	uint32 _poolAllocations;
+	uint32 _systemAllocations;
+};
+
+} // End of namespace Sword25
+
+#endif
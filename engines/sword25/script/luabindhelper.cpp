@@ -266,6 +266,19 @@ void pushMetatableTable(lua_State *L) {
 }
 }
 
+namespace {
+// Metatables found by my_checkudata(), referenced from the registry. The
+// class names are string constants, so they are matched by their address.
+struct MetatableCacheEntry {
+	const char *name;
+	int ref;
+};
+
+const uint METATABLE_CACHE_SIZE = 16;
+MetatableCacheEntry metatableCache[METATABLE_CACHE_SIZE];
+uint metatableCacheCount = 0;
+}
+
 namespace Sword25 {
 
 bool LuaBindhelper::getMetatable(lua_State *L, const Common::String &tableName) {
@@ -300,6 +313,29 @@ bool LuaBindhelper::getMetatable(lua_State *L, const Common::String &tableName)
 	return true;
 }
 
+void LuaBindhelper::pushCachedMetatable(lua_State *L, const char *tname) {
+	for (uint i = 0; i < metatableCacheCount; ++i) {
+		if (metatableCache[i].name == tname) {
+			lua_rawgeti(L, LUA_REGISTRYINDEX, metatableCache[i].ref);
+			return;
+		}
+	}
+
+	getMetatable(L, tname);
+	if (metatableCacheCount < METATABLE_CACHE_SIZE) {
+		lua_pushvalue(L, -1);
+		metatableCache[metatableCacheCount].name = tname;
+		metatableCache[metatableCacheCount].ref = luaL_ref(L, LUA_REGISTRYINDEX);
+		++metatableCacheCount;
+	}
+}
+
+void LuaBindhelper::clearMetatableCache(lua_State *L) {
+	for (uint i = 0; i < metatableCacheCount; ++i)
+		luaL_unref(L, LUA_REGISTRYINDEX, metatableCache[i].ref);
+	metatableCacheCount = 0;
+}
+
 // Like luaL_checkudata, only without that no error is generated.
 void *LuaBindhelper::my_checkudata(lua_State *L, int ud, const char *tname) {
 	int top = lua_gettop(L);
@@ -308,7 +344,7 @@ void *LuaBindhelper::my_checkudata(lua_State *L, int ud, const char *tname) {
 	if (p != NULL) { /* value is a userdata? */
 		if (lua_getmetatable(L, ud)) { /* does it have a metatable? */
 			// lua_getfield(L, LUA_REGISTRYINDEX, tname);  /* get correct metatable */
-			LuaBindhelper::getMetatable(L, tname);
+			pushCachedMetatable(L, tname);
 			if (lua_rawequal(L, -1, -2)) { /* does it have the correct mt? */
 				lua_settop(L, top);
 				return p;
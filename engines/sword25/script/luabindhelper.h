@@ -107,10 +107,23 @@ public:
 
 	static bool getMetatable(lua_State *L, const Common::String &tableName);
 
+	/**
+	 * Like luaL_checkudata(), but returns 0 instead of raising an error.
+	 * The metatables are looked up once and then kept in the registry, as
+	 * this is called by nearly every method of the script objects.
+	 * @remark              tname is expected to be a string constant
+	 */
 	static void *my_checkudata(lua_State *L, int ud, const char *tname);
 
+	/**
+	 * Forget the metatables remembered by my_checkudata(). Must be called
+	 * when the metatables are replaced, i.e. when a savegame is loaded.
+	 */
+	static void clearMetatableCache(lua_State *L);
+
 private:
 	static bool createTable(lua_State *L, const Common::String &tableName);
+	static void pushCachedMetatable(lua_State *L, const char *tname);
 };
 
 } // End of namespace Sword25
@@ -35,6 +35,7 @@
 #include "sword25/sword25.h"
 #include "sword25/package/packagemanager.h"
 #include "sword25/script/luascript.h"
+#include "sword25/script/luaallocator.h"
 #include "sword25/script/luabindhelper.h"
 
 #include "sword25/kernel/outputpersistenceblock.h"
@@ -47,16 +48,34 @@
 
 namespace Sword25 {
 
+namespace {
+// Frames are drawn at up to 60 fps, time left from this is spent on the GC
+const uint FRAME_BUDGET = 1000 / 60;
+// Size of the incremental GC steps done at the end of frames in KB
+const int GC_STEP_SIZE_MIN = 1;
+const int GC_STEP_SIZE_MAX = 64;
+const int GC_STEP_SIZE_DEFAULT = 8;
+}
+
 LuaScriptEngine::LuaScriptEngine(Kernel *KernelPtr) :
 	ScriptEngine(KernelPtr),
 	_state(0),
-	_pcallErrorhandlerRegistryIndex(0) {
+	_allocator(0),
+	_pcallErrorhandlerRegistryIndex(0),
+	_lastFrameEnd(0),
+	_gcStepSize(GC_STEP_SIZE_DEFAULT) {
+	resetFrameStats();
 }
 
 LuaScriptEngine::~LuaScriptEngine() {
 	// Lua de-initialisation
-	if (_state)
+	if (_state) {
+		LuaBindhelper::clearMetatableCache(_state);
 		lua_close(_state);
+	}
+
+	// Only after the state is gone, as it still frees memory while closing
+	delete _allocator;
 }
 
 namespace {
@@ -75,7 +94,8 @@ void debugHook(lua_State *L, lua_Debug *ar) {
 
 bool LuaScriptEngine::init() {
 	// Lua-State initialisation, as well as standard libaries initialisation
-	_state = luaL_newstate();
+	_allocator = new LuaAllocator();
+	_state = lua_newstate(LuaAllocator::alloc, _allocator);
 	if (!_state || ! registerStandardLibs() || !registerStandardLibExtensions()) {
 		error("Lua could not be initialized.");
 		return false;
@@ -172,6 +192,42 @@ bool LuaScriptEngine::executeFile(const Common::String &fileName) {
 	return true;
 }
 
+void LuaScriptEngine::frameEnded(lua_State *L, uint renderTime) {
+	uint now = Kernel::getInstance()->getMilliTicks();
+	if (_lastFrameEnd == 0) {
+		_lastFrameEnd = now;
+		return;
+	}
+
+	uint frameTime = now - _lastFrameEnd;
+	uint scriptTime = frameTime > renderTime ? frameTime - renderTime : 0;
+
+	// Grow the GC steps while frames finish early, shrink them when frames take too long
+	if (frameTime < FRAME_BUDGET)
+		_gcStepSize = MIN(_gcStepSize * 2, GC_STEP_SIZE_MAX);
+	else
+		_gcStepSize = MAX(_gcStepSize / 2, GC_STEP_SIZE_MIN);
+
+	lua_gc(L, LUA_GCSTEP, _gcStepSize);
+
+	_lastFrameEnd = Kernel::getInstance()->getMilliTicks();
+	uint gcTime = _lastFrameEnd - now;
+
+	++_frameStats.frames;
+	_frameStats.scriptTime += scriptTime;
+	_frameStats.scriptTimeMax = MAX(_frameStats.scriptTimeMax, scriptTime);
+	_frameStats.gcTime += gcTime;
+	_frameStats.gcTimeMax = MAX(_frameStats.gcTimeMax, gcTime);
+}
+
+void LuaScriptEngine::resetFrameStats() {
+	_frameStats.frames = 0;
+	_frameStats.scriptTime = 0;
+	_frameStats.scriptTimeMax = 0;
+	_frameStats.gcTime = 0;
+	_frameStats.gcTimeMax = 0;
+}
+
 bool LuaScriptEngine::executeString(const Common::String &code) {
 	return executeBuffer((const byte *)code.c_str(), code.size(), "???");
 }
@@ -453,6 +509,9 @@ bool LuaScriptEngine::unpersist(InputPersistenceBlock &reader) {
 	// Empty the Lua stack. pluto_persist() xepects that the stack is empty except for its parameters
 	lua_settop(_state, 0);
 
+	// The metatables are replaced by the ones from the savegame
+	LuaBindhelper::clearMetatableCache(_state);
+
 	// Permanents table is placed on the stack. This has already happened at this point, because
 	// to create the table all permanents must be accessible. This is the case only for the
 	// beginning of the function, because the global table is emptied below
@@ -509,6 +568,8 @@ bool LuaScriptEngine::unpersist(InputPersistenceBlock &reader) {
 	// Force garbage collection
 	lua_gc(_state, LUA_GCCOLLECT, 0);
 
+	LuaBindhelper::clearMetatableCache(_state);
+
 	return true;
 }
 
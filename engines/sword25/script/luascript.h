@@ -42,6 +42,7 @@ struct lua_State;
 namespace Sword25 {
 
 class Kernel;
+class LuaAllocator;
 
 class LuaScriptEngine : public ScriptEngine {
 public:
@@ -93,10 +94,45 @@ public:
 	 */
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
+	/**
+	 * Called by Gfx.EndFrame() once a frame has been drawn.
+	 * Records the time spent in scripts during the frame, and spends time
+	 * that is left in the frame on an incremental garbage collection step.
+	 * Doing this regularly keeps the collector from doing large steps in
+	 * the middle of the game logic.
+	 * @param L             The Lua thread calling Gfx.EndFrame()
+	 * @param renderTime    The time spent drawing the frame in milliseconds
+	 */
+	void frameEnded(lua_State *L, uint renderTime);
+
+	struct FrameStats {
+		uint frames;
+		uint scriptTime;
+		uint scriptTimeMax;
+		uint gcTime;
+		uint gcTimeMax;
+	};
+
+	const FrameStats &getFrameStats() const {
+		return _frameStats;
+	}
+	void resetFrameStats();
+	int getGCStepSize() const {
+		return _gcStepSize;
+	}
+	LuaAllocator *getAllocator() const {
+		return _allocator;
+	}
+
 private:
 	lua_State *_state;
+	LuaAllocator *_allocator;
 	int _pcallErrorhandlerRegistryIndex;
 
+	uint _lastFrameEnd;
+	int _gcStepSize;
+	FrameStats _frameStats;
+
 	bool registerStandardLibs();
 	bool registerStandardLibExtensions();
 	bool executeBuffer(const byte *data, uint size, const Common::String &name) const;
@@ -57,7 +57,6 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -74,8 +73,7 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		it = _renderQueue.erase(it);
 		delete ticket;
 	}
-
-	delete _dirtyRect;
+	_ticketIndex.clear();
 
 	_renderSurface->free();
 	delete _renderSurface;
@@ -154,8 +152,7 @@ bool BaseRenderOSystem::indicatorFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -176,9 +173,7 @@ bool BaseRenderOSystem::flip() {
 		RenderQueueIterator it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
-				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
-				delete ticket;
+				it = deleteTicket(it);
 			} else {
 				(*it)->_wantsDraw = false;
 				++it;
@@ -195,8 +190,7 @@ bool BaseRenderOSystem::flip() {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
 		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -273,7 +267,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	if (_disableDirtyRects) {
 		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(_renderQueue.end(), ticket);
 		drawFromSurface(ticket);
 		return;
 	}
@@ -285,22 +279,10 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
-			}
+		RenderTicket *compareTicket = findReusableTicket(compare);
+		if (compareTicket) {
+			drawFromQueuedTicket(compareTicket->_queuePos);
+			return;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
@@ -308,7 +290,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		drawFromTicket(ticket);
 	} else {
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(_renderQueue.end(), ticket);
 		drawFromSurface(ticket);
 	}
 }
@@ -335,13 +317,13 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	// In-order
 	if (_renderQueue.empty() || _lastFrameIter == _renderQueue.end()) {
 		_lastFrameIter--;
-		_renderQueue.push_back(renderTicket);
+		queueTicket(_renderQueue.end(), renderTicket);
 		++_lastFrameIter;
 		addDirtyRect(renderTicket->_dstRect);
 	} else {
 		// Before something
 		RenderQueueIterator pos = _lastFrameIter;
-		_renderQueue.insert(pos, renderTicket);
+		queueTicket(pos, renderTicket);
 		--_lastFrameIter;
 		addDirtyRect(renderTicket->_dstRect);
 	}
@@ -358,70 +340,148 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 		--_lastFrameIter;
 		// Remove the ticket from the list
 		assert(*_lastFrameIter != renderTicket);
+		removeFromIndex(renderTicket);
 		_renderQueue.erase(ticket);
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
 	}
 }
 
-void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
+void BaseRenderOSystem::queueTicket(const RenderQueueIterator &pos, RenderTicket *renderTicket) {
+	_renderQueue.insert(pos, renderTicket);
+	renderTicket->_queuePos = pos;
+	--renderTicket->_queuePos;
+
+	RenderTicket *&bucket = _ticketIndex[renderTicket->_hash];
+	renderTicket->_nextInBucket = bucket;
+	bucket = renderTicket;
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::deleteTicket(const RenderQueueIterator &ticket) {
+	RenderTicket *renderTicket = *ticket;
+	removeFromIndex(renderTicket);
+	RenderQueueIterator next = _renderQueue.erase(ticket);
+	delete renderTicket;
+	return next;
+}
+
+void BaseRenderOSystem::removeFromIndex(RenderTicket *renderTicket) {
+	TicketIndex::iterator bucket = _ticketIndex.find(renderTicket->_hash);
+	if (bucket == _ticketIndex.end()) {
+		return;
+	}
+
+	if (bucket->_value == renderTicket) {
+		if (renderTicket->_nextInBucket) {
+			bucket->_value = renderTicket->_nextInBucket;
+		} else {
+			_ticketIndex.erase(bucket);
+		}
 	} else {
-		_dirtyRect->extend(rect);
+		RenderTicket *prev = bucket->_value;
+		while (prev->_nextInBucket && prev->_nextInBucket != renderTicket) {
+			prev = prev->_nextInBucket;
+		}
+		if (prev->_nextInBucket) {
+			prev->_nextInBucket = renderTicket->_nextInBucket;
+		}
 	}
-	_dirtyRect->clip(_renderRect);
+	renderTicket->_nextInBucket = nullptr;
 }
 
-void BaseRenderOSystem::drawTickets() {
-	RenderQueueIterator it = _renderQueue.begin();
-	// Clean out the old tickets
-	// Note: We draw invalid tickets too, otherwise we wouldn't be honoring
-	// the draw request they obviously made BEFORE becoming invalid, either way
-	// we have a copy of their data, so their invalidness won't affect us.
-	while (it != _renderQueue.end()) {
-		if ((*it)->_wantsDraw == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
+RenderTicket *BaseRenderOSystem::findReusableTicket(const RenderTicket &compare) const {
+	TicketIndex::const_iterator bucket = _ticketIndex.find(compare._hash);
+	if (bucket == _ticketIndex.end()) {
+		return nullptr;
+	}
+
+	// Tickets already drawn this frame are the ones up to _lastFrameIter,
+	// so skipping them matches searching the queue after _lastFrameIter
+	RenderTicket *found = nullptr;
+	for (RenderTicket *ticket = bucket->_value; ticket; ticket = ticket->_nextInBucket) {
+		if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare) {
+			if (found) {
+				// The bucket is ordered by insertion, not by queue position.
+				// Duplicates are rare, so find the first one in queue order
+				// the way the search did before there was an index.
+				RenderQueueIterator it = _lastFrameIter;
+				for (++it; it != _renderQueue.end(); ++it) {
+					if (!(*it)->_wantsDraw && (*it)->_isValid && **it == compare) {
+						return *it;
+					}
+				}
+			}
+			found = ticket;
+		}
+	}
+	return found;
+}
+
+void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
+	Common::Rect dirty(rect);
+	dirty.clip(_renderRect);
+	if (dirty.isEmpty()) {
+		return;
+	}
+
+	// Keep the rects disjoint, so nothing is drawn twice. A grown rect
+	// can overlap rects it was checked against before, so start over.
+	uint i = 0;
+	while (i < _dirtyRects.size()) {
+		if (_dirtyRects[i].intersects(dirty)) {
+			dirty.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
 		} else {
-			++it;
+			++i;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
-		it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			RenderTicket *ticket = *it;
-			ticket->_wantsDraw = false;
-			++it;
+
+	if (_dirtyRects.size() >= kMaxDirtyRects) {
+		// Too fragmented, merge with the rect that grows the least
+		uint best = 0;
+		int32 bestGrowth = 0;
+		for (i = 0; i < _dirtyRects.size(); ++i) {
+			Common::Rect merged(_dirtyRects[i]);
+			merged.extend(dirty);
+			int32 growth = merged.width() * merged.height() - _dirtyRects[i].width() * _dirtyRects[i].height();
+			if (i == 0 || growth < bestGrowth) {
+				best = i;
+				bestGrowth = growth;
+			}
 		}
+		dirty.extend(_dirtyRects[best]);
+		_dirtyRects.remove_at(best);
+		addDirtyRect(dirty);
 		return;
 	}
 
-	it = _renderQueue.begin();
-	_lastFrameIter = _renderQueue.end();
+	_dirtyRects.push_back(dirty);
+}
+
+void BaseRenderOSystem::drawDirtyRect(const Common::Rect &dirtyRect) {
+	RenderQueueIterator it = _renderQueue.begin();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+	if (it != _renderQueue.end() && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
 		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		if (dirtyRect != (*it)->_dstRect) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
 		// Otherwise Do NOT fill.
 	} else {
 		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+		_renderSurface->fillRect(dirtyRect, _clearColor);
 	}
 	for (; it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
+		if (ticket->_dstRect.intersects(dirtyRect)) {
 			// dstClip is the area we want redrawn.
 			Common::Rect dstClip(ticket->_dstRect);
 			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
+			dstClip.clip(dirtyRect);
 			// we need to keep track of the position to redraw the dirty rect
 			Common::Rect pos(dstClip);
 			int16 offsetX = ticket->_dstRect.left;
@@ -432,19 +492,50 @@ void BaseRenderOSystem::drawTickets() {
 			drawFromSurface(ticket, &pos, &dstClip);
 			_needsFlip = true;
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
+	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+}
+
+void BaseRenderOSystem::drawTickets() {
+	RenderQueueIterator it = _renderQueue.begin();
+	// Clean out the old tickets
+	// Note: We draw invalid tickets too, otherwise we wouldn't be honoring
+	// the draw request they obviously made BEFORE becoming invalid, either way
+	// we have a copy of their data, so their invalidness won't affect us.
+	while (it != _renderQueue.end()) {
+		if ((*it)->_wantsDraw == false) {
+			addDirtyRect((*it)->_dstRect);
+			it = deleteTicket(it);
+		} else {
+			++it;
+		}
+	}
+	if (_dirtyRects.empty()) {
+		it = _renderQueue.begin();
+		while (it != _renderQueue.end()) {
+			RenderTicket *ticket = *it;
+			ticket->_wantsDraw = false;
+			++it;
+		}
+		return;
+	}
+
+	_lastFrameIter = _renderQueue.end();
+	for (uint i = 0; i < _dirtyRects.size(); ++i) {
+		drawDirtyRect(_dirtyRects[i]);
+	}
+
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
+	}
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
 	while (it != _renderQueue.end()) {
 		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
+			it = deleteTicket(it);
 		} else {
 			++it;
 		}
@@ -567,9 +658,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	// Clear the scale-buffered tickets as we just loaded.
 	RenderQueueIterator it = _renderQueue.begin();
 	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+		it = deleteTicket(it);
 	}
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
@@ -32,6 +32,8 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "graphics/transform_struct.h"
 
@@ -53,6 +55,11 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * Tickets are indexed by a hash of their draw arguments, so finding last frame's
+ * ticket for a draw-call doesn't walk the queue. The areas that changed are kept
+ * as a small set of non-overlapping rects, so two sprites animating in opposite
+ * corners don't cause the whole screen in between to be redrawn.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accomodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -118,6 +125,25 @@ private:
 	 * @param rect the region to be marked as dirty
 	 */
 	void addDirtyRect(const Common::Rect &rect);
+	/**
+	 * Add a ticket to the queue before the given position and index it.
+	 */
+	void queueTicket(const RenderQueueIterator &pos, RenderTicket *renderTicket);
+	/**
+	 * Remove a ticket from the queue and the index and delete it.
+	 * @return iterator pointing to the following ticket
+	 */
+	RenderQueueIterator deleteTicket(const RenderQueueIterator &ticket);
+	void removeFromIndex(RenderTicket *renderTicket);
+	/**
+	 * Look up a valid ticket from last frame that hasn't been drawn yet in
+	 * this frame and matches the draw arguments of compare.
+	 */
+	RenderTicket *findReusableTicket(const RenderTicket &compare) const;
+	/**
+	 * Fill the dirty rect with the clear color and redraw the tickets covering it.
+	 */
+	void drawDirtyRect(const Common::Rect &dirtyRect);
 	/**
 	 * Traverse the tickets that are dirty, and draw them
 	 */
@@ -126,8 +152,15 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	enum {
+		kMaxDirtyRects = 16
+	};
+
+	typedef Common::HashMap<uint32, RenderTicket *> TicketIndex;
+
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	TicketIndex _ticketIndex;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
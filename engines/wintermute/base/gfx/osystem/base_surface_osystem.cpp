@@ -51,10 +51,15 @@ BaseSurfaceOSystem::BaseSurfaceOSystem(BaseGame *inGame) : BaseSurface(inGame) {
 	_lockPitch = 0;
 	_loaded = false;
 	_rotation = 0;
+	_transformedWidth = 0;
+	_transformedHeight = 0;
+	_transformedBilinear = false;
 }
 
 //////////////////////////////////////////////////////////////////////////
 BaseSurfaceOSystem::~BaseSurfaceOSystem() {
+	invalidateTransformed();
+
 	if (_surface) {
 		_surface->free();
 		delete _surface;
@@ -147,6 +152,7 @@ bool BaseSurfaceOSystem::finishLoad() {
 		// FIBITMAP *newImg = FreeImage_ConvertToGreyscale(img); TODO
 	}
 
+	invalidateTransformed();
 	_surface->free();
 	delete _surface;
 
@@ -336,6 +342,7 @@ bool BaseSurfaceOSystem::startPixelOp() {
 	// Any pixel-op makes the caching useless:
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
+	invalidateTransformed();
 	return STATUS_OK;
 }
 
@@ -461,8 +468,58 @@ bool BaseSurfaceOSystem::drawSprite(int x, int y, Rect32 *rect, Rect32 *newRect,
 	return STATUS_OK;
 }
 
+Common::SharedPtr<Graphics::Surface> BaseSurfaceOSystem::getTransformedSurface(const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear) {
+	if (_transformed &&
+	        _transformedSrcRect == srcRect &&
+	        _transformedWidth == dstRect.width() &&
+	        _transformedHeight == dstRect.height() &&
+	        _transformedTransform._angle == transform._angle &&
+	        _transformedTransform._zoom == transform._zoom &&
+	        _transformedTransform._hotspot == transform._hotspot &&
+	        _transformedBilinear == bilinear) {
+		return _transformed;
+	}
+
+	invalidateTransformed();
+
+	// The bilinear scaler expects a tightly packed source, so work on a
+	// clipped copy rather than on a sub-area of the surface
+	Graphics::TransparentSurface src;
+	src.copyFrom(_surface->getSubArea(srcRect));
+	Graphics::Surface *transformed;
+	if (transform._angle != Graphics::kDefaultAngle) {
+		if (bilinear) {
+			transformed = src.rotoscaleT<Graphics::FILTER_BILINEAR>(transform);
+		} else {
+			transformed = src.rotoscaleT<Graphics::FILTER_NEAREST>(transform);
+		}
+	} else {
+		if (bilinear) {
+			transformed = src.scaleT<Graphics::FILTER_BILINEAR>(dstRect.width(), dstRect.height());
+		} else {
+			transformed = src.scaleT<Graphics::FILTER_NEAREST>(dstRect.width(), dstRect.height());
+		}
+	}
+	src.free();
+	_transformed = Common::SharedPtr<Graphics::Surface>(transformed, Graphics::SurfaceDeleter());
+
+	_transformedSrcRect = srcRect;
+	_transformedWidth = dstRect.width();
+	_transformedHeight = dstRect.height();
+	_transformedTransform = transform;
+	_transformedBilinear = bilinear;
+
+	return _transformed;
+}
+
+void BaseSurfaceOSystem::invalidateTransformed() {
+	// Tickets still holding the old result keep it alive until they are gone
+	_transformed.reset();
+}
+
 bool BaseSurfaceOSystem::putSurface(const Graphics::Surface &surface, bool hasAlpha) {
 	_loaded = true;
+	invalidateTransformed();
 	if (surface.format == _surface->format && surface.pitch == _surface->pitch && surface.h == _surface->h) {
 		const byte *src = (const byte *)surface.getBasePtr(0, 0);
 		byte *dst = (byte *)_surface->getBasePtr(0, 0);
@@ -33,6 +33,7 @@
 #include "graphics/transparent_surface.h"
 #include "engines/wintermute/base/gfx/base_surface.h"
 #include "common/list.h"
+#include "common/ptr.h"
 
 namespace Wintermute {
 struct TransparentSurface;
@@ -83,9 +84,27 @@ public:
 	}
 
 	Graphics::AlphaType getAlphaType() const { return _alphaType; }
+
+	/**
+	 * Returns srcRect of this surface rotated and/or scaled to the size of dstRect.
+	 * The result of the last transformation is kept around, so that sprites drawn
+	 * with the same zoom or rotation every frame are only transformed once.
+	 */
+	/**
+	 * Returns the surface scaled/rotated as requested. The last result is
+	 * kept and shared with the render tickets that display it.
+	 */
+	Common::SharedPtr<Graphics::Surface> getTransformedSurface(const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear);
 private:
 	Graphics::Surface *_surface;
 	bool _loaded;
+	Common::SharedPtr<Graphics::Surface> _transformed;
+	Common::Rect _transformedSrcRect;
+	int16 _transformedWidth;
+	int16 _transformedHeight;
+	Graphics::TransformStruct _transformedTransform;
+	bool _transformedBilinear;
+	void invalidateTransformed();
 	bool finishLoad();
 	bool drawSprite(int x, int y, Rect32 *rect, Rect32 *newRect, Graphics::TransformStruct transformStruct);
 	void genAlphaMask(Graphics::Surface *surface);
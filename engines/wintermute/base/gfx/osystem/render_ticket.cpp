@@ -41,16 +41,16 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	_dstRect(*dstRect),
 	_isValid(true),
 	_wantsDraw(true),
-	_transform(transform) {
+	_transform(transform),
+	_nextInBucket(nullptr) {
+	_hash = (uint32)(uintptr)owner;
+	_hash = _hash * 31 + (uint16)_dstRect.left + ((uint32)(uint16)_dstRect.top << 16);
+	_hash = _hash * 31 + (uint16)_dstRect.right + ((uint32)(uint16)_dstRect.bottom << 16);
+	_hash = _hash * 31 + (uint16)_srcRect.left + ((uint32)(uint16)_srcRect.top << 16);
+	_hash = _hash * 31 + (uint16)_srcRect.right + ((uint32)(uint16)_srcRect.bottom << 16);
+
 	if (surf) {
-		_surface = new Graphics::Surface();
-		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
-		assert(_surface->format.bytesPerPixel == 4);
-		// Get a clipped copy of the surface
-		for (int i = 0; i < _surface->h; i++) {
-			memcpy(_surface->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * _surface->format.bytesPerPixel);
-		}
-		// Then scale it if necessary
+		// Scale or rotate it if necessary
 		//
 		// NB: The numTimesX/numTimesY properties don't yet mix well with
 		// scaling and rotation, but there is no need for that functionality at
@@ -58,41 +58,32 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 		// NB: Mirroring and rotation are probably done in the wrong order.
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
-		if (_transform._angle != Graphics::kDefaultAngle) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
-				temp = src.rotoscaleT<Graphics::FILTER_BILINEAR>(transform);
-			} else {
-				temp = src.rotoscaleT<Graphics::FILTER_NEAREST>(transform);
-			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
-		} else if ((dstRect->width() != srcRect->width() ||
-					dstRect->height() != srcRect->height()) &&
-					_transform._numTimesX * _transform._numTimesY == 1) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
-				temp = src.scaleT<Graphics::FILTER_BILINEAR>(dstRect->width(), dstRect->height());
-			} else {
-				temp = src.scaleT<Graphics::FILTER_NEAREST>(dstRect->width(), dstRect->height());
+		bool needsTransform = (_transform._angle != Graphics::kDefaultAngle) ||
+		                      ((dstRect->width() != srcRect->width() ||
+		                        dstRect->height() != srcRect->height()) &&
+		                       _transform._numTimesX * _transform._numTimesY == 1);
+
+		if (needsTransform) {
+			// The owner keeps the last transformed version around, which saves
+			// redoing the transformation for sprites that are zoomed or rotated
+			// the same way in every frame. The result is never modified, so it
+			// can be shared rather than copied.
+			_surface = owner->getTransformedSurface(*srcRect, *dstRect, transform, owner->_gameRef->getBilinearFiltering());
+		} else {
+			// The source may be rewritten in place (videos), so take a copy
+			Graphics::Surface *copy = new Graphics::Surface();
+			copy->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
+			assert(copy->format.bytesPerPixel == 4);
+			// Get a clipped copy of the surface
+			for (int i = 0; i < copy->h; i++) {
+				memcpy(copy->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * copy->format.bytesPerPixel);
 			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
+			_surface = Common::SharedPtr<Graphics::Surface>(copy, Graphics::SurfaceDeleter());
 		}
-	} else {
-		_surface = nullptr;
 	}
 }
 
 RenderTicket::~RenderTicket() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
-	}
 }
 
 bool RenderTicket::operator==(const RenderTicket &t) const {
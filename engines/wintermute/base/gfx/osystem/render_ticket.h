@@ -31,6 +31,8 @@
 
 #include "graphics/transparent_surface.h"
 #include "graphics/surface.h"
+#include "common/list.h"
+#include "common/ptr.h"
 #include "common/rect.h"
 
 namespace Wintermute {
@@ -48,13 +50,15 @@ class BaseSurfaceOSystem;
  * (Video-surfaces may even change their data). The promise that is made when a ticket
  * is created is that what the state was of the surface at THAT point, is what will end
  * up on screen at flip() time.
+ * Tickets drawn with a transformation share the transformed surface with
+ * their owner instead of copying it.
  */
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _hash(0), _nextInBucket(nullptr) {}
 	~RenderTicket();
-	const Graphics::Surface *getSurface() const { return _surface; }
+	const Graphics::Surface *getSurface() const { return _surface.get(); }
 	// Non-dirty-rects:
 	void drawToSurface(Graphics::Surface *_targetSurface) const;
 	// Dirty-rects:
@@ -70,8 +74,15 @@ public:
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
+
+	/** Hash of the draw arguments, equal tickets have equal hashes */
+	uint32 _hash;
+	/** Next ticket with the same hash in the renderer's ticket index */
+	RenderTicket *_nextInBucket;
+	/** Position of the ticket in the renderer's render queue */
+	Common::List<RenderTicket *>::iterator _queuePos;
 private:
-	Graphics::Surface *_surface;
+	Common::SharedPtr<Graphics::Surface> _surface;
 	Common::Rect _srcRect;
 };
 
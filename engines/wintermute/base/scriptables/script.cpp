@@ -41,7 +41,6 @@ IMPLEMENT_PERSISTENT(ScScript, false)
 
 //////////////////////////////////////////////////////////////////////////
 ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
-	_buffer = nullptr;
 	_bufferSize = _iP = 0;
 	_scriptStream = nullptr;
 	_filename = nullptr;
@@ -49,6 +48,7 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 
 	_symbols = nullptr;
 	_numSymbols = 0;
+	_varCache = nullptr;
 
 	_engine = engine;
 
@@ -121,7 +121,7 @@ void ScScript::readHeader() {
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::initScript() {
 	if (!_scriptStream) {
-		_scriptStream = new Common::MemoryReadStream(_buffer, _bufferSize);
+		_scriptStream = new Common::MemoryReadStream(_buffer.get(), _bufferSize);
 	}
 	readHeader();
 
@@ -176,6 +176,14 @@ bool ScScript::initTables() {
 		_symbols[index] = getString();
 	}
 
+	delete[] _varCache;
+	_varCache = new VarCacheEntry[_numSymbols];
+	for (uint32 i = 0; i < _numSymbols; i++) {
+		_varCache[i].scope = nullptr;
+		_varCache[i].generation = 0;
+		_varCache[i].value = nullptr;
+	}
+
 	// load functions table
 	_iP = _header.funcTable;
 
@@ -251,12 +259,12 @@ bool ScScript::create(const char *filename, byte *buffer, uint32 size, BaseScrip
 		strcpy(_filename, filename);
 	}
 
-	_buffer = new byte [size];
+	_buffer = Common::SharedPtr<byte>(new byte [size], BufferDeleter());
 	if (!_buffer) {
 		return STATUS_FAILED;
 	}
 
-	memcpy(_buffer, buffer, size);
+	memcpy(_buffer.get(), buffer, size);
 
 	_bufferSize = size;
 
@@ -291,13 +299,12 @@ bool ScScript::createThread(ScScript *original, uint32 initIP, const Common::Str
 		strcpy(_filename, original->_filename);
 	}
 
-	// copy buffer
-	_buffer = new byte [original->_bufferSize];
+	// share buffer
+	_buffer = original->_buffer;
 	if (!_buffer) {
 		return STATUS_FAILED;
 	}
 
-	memcpy(_buffer, original->_buffer, original->_bufferSize);
 	_bufferSize = original->_bufferSize;
 
 	// initialize
@@ -348,13 +355,12 @@ bool ScScript::createMethodThread(ScScript *original, const Common::String &meth
 		strcpy(_filename, original->_filename);
 	}
 
-	// copy buffer
-	_buffer = new byte [original->_bufferSize];
+	// share buffer
+	_buffer = original->_buffer;
 	if (!_buffer) {
 		return STATUS_FAILED;
 	}
 
-	memcpy(_buffer, original->_buffer, original->_bufferSize);
 	_bufferSize = original->_bufferSize;
 
 	// initialize
@@ -382,10 +388,7 @@ bool ScScript::createMethodThread(ScScript *original, const Common::String &meth
 
 //////////////////////////////////////////////////////////////////////////
 void ScScript::cleanup() {
-	if (_buffer) {
-		delete[] _buffer;
-	}
-	_buffer = nullptr;
+	_buffer.reset();
 
 	if (_filename) {
 		delete[] _filename;
@@ -398,6 +401,9 @@ void ScScript::cleanup() {
 	_symbols = nullptr;
 	_numSymbols = 0;
 
+	delete[] _varCache;
+	_varCache = nullptr;
+
 	if (_globals && !_thread) {
 		delete _globals;
 	}
@@ -469,18 +475,24 @@ void ScScript::cleanup() {
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getDWORD() {
-	_scriptStream->seek((int32)_iP);
-	uint32 ret = _scriptStream->readUint32LE();
+	// Operands are read straight from the buffer, seeking the stream for
+	// every one of them was a large part of the interpreter's time
+	uint32 ret = 0;
+	if (_iP + sizeof(uint32) <= _bufferSize) {
+		ret = READ_LE_UINT32(_buffer.get() + _iP);
+	}
 	_iP += sizeof(uint32);
-//	assert(oldRet == ret);
 	return ret;
 }
 
 //////////////////////////////////////////////////////////////////////////
 double ScScript::getFloat() {
-	_scriptStream->seek((int32)_iP);
 	byte buffer[8];
-	_scriptStream->read(buffer, 8);
+	if (_iP + 8 <= _bufferSize) {
+		memcpy(buffer, _buffer.get() + _iP, 8);
+	} else {
+		memset(buffer, 0, 8);
+	}
 
 #ifdef SCUMM_BIG_ENDIAN
 	// TODO: For lack of a READ_LE_UINT64
@@ -499,12 +511,11 @@ double ScScript::getFloat() {
 
 //////////////////////////////////////////////////////////////////////////
 char *ScScript::getString() {
-	char *ret = (char *)(_buffer + _iP);
-	while (*(char *)(_buffer + _iP) != '\0') {
+	char *ret = (char *)(_buffer.get() + _iP);
+	while (*(char *)(_buffer.get() + _iP) != '\0') {
 		_iP++;
 	}
 	_iP++; // string terminator
-	_scriptStream->seek(_iP);
 
 	return ret;
 }
@@ -697,7 +708,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVarBySymbol(getDWORD());
 		if (false && /*var->_type==VAL_OBJECT ||*/ var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
 			_stack->push(_operand);
@@ -708,15 +719,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVarBySymbol(getDWORD());
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getVarBySymbol(getDWORD());
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -769,7 +779,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getVarBySymbol(getDWORD()));
 		_thisStack->push(_operand);
 		break;
 
@@ -1170,6 +1180,30 @@ ScValue *ScScript::getVar(char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+static inline bool isPlainScope(const ScValue *scope) {
+	// Natives and references resolve properties elsewhere, don't cache those
+	return scope == nullptr || scope->_type == VAL_NULL || scope->_type == VAL_OBJECT;
+}
+
+ScValue *ScScript::getVarBySymbol(uint32 index) {
+	ScValue *scope = (_scopeStack->_sP >= 0) ? _scopeStack->getTop() : nullptr;
+	bool cacheable = isPlainScope(scope) && isPlainScope(_globals) && isPlainScope(_engine->_globals);
+
+	VarCacheEntry &entry = _varCache[index];
+	if (cacheable && entry.value && entry.scope == scope && entry.generation == ScValue::_propsGeneration) {
+		return entry.value;
+	}
+
+	ScValue *ret = getVar(_symbols[index]);
+
+	entry.scope = scope;
+	entry.generation = ScValue::_propsGeneration;
+	entry.value = cacheable ? ret : nullptr;
+	return ret;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::waitFor(BaseObject *object) {
 	if (_unbreakable) {
@@ -1257,7 +1291,7 @@ bool ScScript::persist(BasePersistenceManager *persistMgr) {
 	if (persistMgr->getIsSaving()) {
 		if (_state != SCRIPT_PERSISTENT && _state != SCRIPT_FINISHED && _state != SCRIPT_THREAD_FINISHED) {
 			persistMgr->transferUint32(TMEMBER(_bufferSize));
-			persistMgr->putBytes(_buffer, _bufferSize);
+			persistMgr->putBytes(_buffer.get(), _bufferSize);
 		} else {
 			// don't save idle/finished scripts
 			int32 bufferSize = 0;
@@ -1266,12 +1300,12 @@ bool ScScript::persist(BasePersistenceManager *persistMgr) {
 	} else {
 		persistMgr->transferUint32(TMEMBER(_bufferSize));
 		if (_bufferSize > 0) {
-			_buffer = new byte[_bufferSize];
-			persistMgr->getBytes(_buffer, _bufferSize);
-			_scriptStream = new Common::MemoryReadStream(_buffer, _bufferSize);
+			_buffer = Common::SharedPtr<byte>(new byte[_bufferSize], BufferDeleter());
+			persistMgr->getBytes(_buffer.get(), _bufferSize);
+			_scriptStream = new Common::MemoryReadStream(_buffer.get(), _bufferSize);
 			initTables();
 		} else {
-			_buffer = nullptr;
+			_buffer.reset();
 			_scriptStream = nullptr;
 		}
 	}
@@ -1449,7 +1483,7 @@ bool ScScript::finishThreads() {
 
 //////////////////////////////////////////////////////////////////////////
 void ScScript::afterLoad() {
-	if (_buffer == nullptr) {
+	if (!_buffer) {
 		byte *buffer = _engine->getCompiledScript(_filename, &_bufferSize);
 		if (!buffer) {
 			_gameRef->LOG(0, "Error reinitializing script '%s' after load. Script will be terminated.", _filename);
@@ -1457,11 +1491,11 @@ void ScScript::afterLoad() {
 			return;
 		}
 
-		_buffer = new byte [_bufferSize];
-		memcpy(_buffer, buffer, _bufferSize);
+		_buffer = Common::SharedPtr<byte>(new byte [_bufferSize], BufferDeleter());
+		memcpy(_buffer.get(), buffer, _bufferSize);
 
 		delete _scriptStream;
-		_scriptStream = new Common::MemoryReadStream(_buffer, _bufferSize);
+		_scriptStream = new Common::MemoryReadStream(_buffer.get(), _bufferSize);
 
 		initTables();
 	}
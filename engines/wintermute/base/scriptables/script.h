@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/persistent.h"
+#include "common/ptr.h"
 
 namespace Wintermute {
 class BaseScriptHolder;
@@ -136,9 +137,14 @@ public:
 	bool create(const char *filename, byte *buffer, uint32 size, BaseScriptHolder *owner);
 	uint32 _iP;
 private:
+	struct BufferDeleter {
+		void operator()(byte *ptr) { delete[] ptr; }
+	};
+
 	void readHeader();
 	uint32 _bufferSize;
-	byte *_buffer;
+	// Threads of a script never modify the code, so they share the buffer
+	Common::SharedPtr<byte> _buffer;
 public:
 	Common::SeekableReadStream *_scriptStream;
 	ScScript(BaseGame *inGame, ScEngine *engine);
@@ -165,6 +171,18 @@ private:
 	bool initScript();
 	bool initTables();
 
+	/**
+	 * A variable lookup remembered for one symbol. It stays valid while the
+	 * same scope is on top and no properties were added or removed since.
+	 */
+	struct VarCacheEntry {
+		ScValue *scope;
+		uint32 generation;
+		ScValue *value;
+	};
+	VarCacheEntry *_varCache;
+	ScValue *getVarBySymbol(uint32 index);
+
 	virtual void preInstHook(uint32 inst);
 	virtual void postInstHook(uint32 inst);
 };
@@ -119,27 +119,33 @@ ScValue *ScStack::getAt(int index) {
 void ScStack::correctParams(uint32 expectedParams) {
 	uint32 nuParams = (uint32)pop()->getInt();
 
+	// Values above the stack pointer are kept for reuse, so move values
+	// around instead of freeing and allocating them
 	if (expectedParams < nuParams) { // too many params
 		while (expectedParams < nuParams) {
 			//Pop();
-			delete _values[_sP - expectedParams];
+			ScValue *extraVal = _values[_sP - expectedParams];
 			_values.remove_at(_sP - expectedParams);
+			extraVal->cleanup();
+			_values.add(extraVal);
 			nuParams--;
 			_sP--;
 		}
 	} else if (expectedParams > nuParams) { // need more params
 		while (expectedParams > nuParams) {
 			//Push(null_val);
-			ScValue *nullVal = new ScValue(_gameRef);
+			ScValue *nullVal;
+			if ((int32)_values.size() > _sP + 1) {
+				nullVal = _values[_values.size() - 1];
+				_values.remove_at(_values.size() - 1);
+				nullVal->cleanup();
+			} else {
+				nullVal = new ScValue(_gameRef);
+			}
 			nullVal->setNULL();
 			_values.insert_at(_sP - nuParams + 1, nullVal);
 			nuParams++;
 			_sP++;
-
-			if ((int32)_values.size() > _sP + 1) {
-				delete _values[_values.size() - 1];
-				_values.remove_at(_values.size() - 1);
-			}
 		}
 	}
 }
@@ -42,6 +42,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScValue, false)
 
+uint32 ScValue::_propsGeneration = 0;
+
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_type = VAL_NULL;
@@ -154,6 +156,8 @@ void ScValue::cleanup(bool ignoreNatives) {
 //////////////////////////////////////////////////////////////////////////
 ScValue::~ScValue() {
 	cleanup();
+	// The address may be reused by a new value
+	++_propsGeneration;
 }
 
 
@@ -201,6 +205,7 @@ bool ScValue::deleteProp(const char *name) {
 	if (_valIter != _valObject.end()) {
 		delete _valIter->_value;
 		_valIter->_value = nullptr;
+		++_propsGeneration;
 	}
 
 	return STATUS_OK;
@@ -228,6 +233,7 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
+			++_propsGeneration;
 		} else {
 			newVal->cleanup();
 		}
@@ -272,6 +278,9 @@ bool ScValue::propExists(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::deleteProps() {
+	if (!_valObject.empty()) {
+		++_propsGeneration;
+	}
 	_valIter = _valObject.begin();
 	while (_valIter != _valObject.end()) {
 		delete(ScValue *)_valIter->_value;
@@ -741,6 +750,7 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 
 	// copy properties
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
+		++_propsGeneration;
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
 			_valObject[orig->_valIter->_key] = new ScValue(_gameRef);
@@ -814,6 +824,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 		}
 	} else {
 		ScValue *val = nullptr;
+		++_propsGeneration;
 		persistMgr->transferSint32("", &size);
 		for (int i = 0; i < size; i++) {
 			persistMgr->transferConstChar("", &str);
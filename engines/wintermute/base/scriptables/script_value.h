@@ -101,6 +101,13 @@ public:
 	Common::HashMap<Common::String, ScValue *> _valObject;
 	Common::HashMap<Common::String, ScValue *>::iterator _valIter;
 
+	/**
+	 * Bumped whenever a property is added or removed anywhere, or a value is
+	 * destroyed. Lookups cached by the script interpreter are only valid as
+	 * long as it doesn't change.
+	 */
+	static uint32 _propsGeneration;
+
 	bool setProperty(const char *propName, int32 value);
 	bool setProperty(const char *propName, const char *value);
 	bool setProperty(const char *propName, double value);
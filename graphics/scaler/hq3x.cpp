@@ -126,6 +126,14 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 	//	 | w7 | w8 | w9 |
 	//	 +----+----+----+
 
+	// The neighbour pattern is symmetric: the upper bits of a pixel are the
+	// lower bits of the pixels in the row above, and its left bit is the
+	// right bit of the previous pixel. belowBits keeps the lower bits
+	// (0x20, 0x40, 0x80) of the previous row, indexed by x + 1, so only four
+	// of the eight YUV comparisons have to be done for each pixel.
+	byte *belowBits = new byte[width + 2];
+	initBelowBits(belowBits, p - nextlineSrc, nextlineSrc, width, RGBtoYUV);
+
 	while (height--) {
 		w1 = *(p - 1 - nextlineSrc);
 		w4 = *(p - 1);
@@ -135,6 +143,10 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 		w5 = *(p);
 		w8 = *(p + nextlineSrc);
 
+		int diff4 = (w5 != w4 && diffYUV(YUV(5), YUV(4)));
+		int pendingBits = (w4 != w8 && diffYUV(YUV(4), YUV(8))) << 7;
+
+		byte *bits = belowBits;
 		int tmpWidth = width;
 		while (tmpWidth--) {
 			p++;
@@ -143,16 +155,25 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
 			const int yuv5 = YUV(5);
-			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
-			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
-			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
-			if (w5 != w4 && diffYUV(yuv5, YUV(4))) pattern |= 0x0008;
-			if (w5 != w6 && diffYUV(yuv5, YUV(6))) pattern |= 0x0010;
-			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
-			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
-			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
+			const int diff6 = (w5 != w6 && diffYUV(yuv5, YUV(6)));
+			int lowerBits = 0;
+			if (w5 != w7 && diffYUV(yuv5, YUV(7))) lowerBits |= 0x0020;
+			if (w5 != w8 && diffYUV(yuv5, YUV(8))) lowerBits |= 0x0040;
+			if (w5 != w9 && diffYUV(yuv5, YUV(9))) lowerBits |= 0x0080;
+
+			const int pattern =
+				((bits[0] >> 7) & 0x01) |
+				((bits[1] >> 5) & 0x02) |
+				((bits[2] >> 3) & 0x04) |
+				(diff4 << 3) |
+				(diff6 << 4) |
+				lowerBits;
+
+			// bits[0] is not needed by the next pixel anymore
+			bits[0] = pendingBits;
+			pendingBits = lowerBits;
+			bits++;
 
 			switch (pattern) {
 			case 0:
@@ -2927,11 +2948,18 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w5 = w6;
 			w8 = w9;
 
+			diff4 = diff6;
+
 			q += 3;
 		}
+		bits[0] = pendingBits;
+		bits[1] = (w5 != w7 && diffYUV(YUV(5), YUV(7))) << 5;
+
 		p += nextlineSrc - width;
 		q += (nextlineDst - width) * 3;
 	}
+
+	delete[] belowBits;
 }
 
 void HQ3x(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
@@ -524,4 +524,25 @@ static inline bool diffYUV(int yuv1, int yuv2) {
 */
 }
 
+/**
+ * Compute the lower neighbour pattern bits (0x20 below left, 0x40 below,
+ * 0x80 below right) of a row of 16 bit pixels, as used by the hq scalers.
+ * bits[x + 1] receives the bits of row[x] for x in [-1, width]. For the two
+ * border pixels only the bit pointing inside the row is computed, as the
+ * pixels further outside are not part of the source.
+ */
+static inline void initBelowBits(byte *bits, const uint16 *row, uint32 pitch, int width, const uint32 *yuvTable) {
+	const uint16 *below = row + pitch;
+
+	bits[0] = diffYUV(yuvTable[row[-1]], yuvTable[below[0]]) << 7;
+	for (int x = 0; x < width; ++x) {
+		const int yuv = yuvTable[row[x]];
+		bits[x + 1] =
+			(diffYUV(yuv, yuvTable[below[x - 1]]) << 5) |
+			(diffYUV(yuv, yuvTable[below[x]]) << 6) |
+			(diffYUV(yuv, yuvTable[below[x + 1]]) << 7);
+	}
+	bits[width + 1] = diffYUV(yuvTable[row[width]], yuvTable[below[width - 1]]) << 5;
+}
+
 #endif
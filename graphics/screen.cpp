@@ -40,21 +40,28 @@ Screen::Screen(int width, int height, PixelFormat pixelFormat): ManagedSurface()
 }
 
 void Screen::update() {
-	// Merge the dirty rects
-	mergeDirtyRects();
-
-	// Loop through copying dirty areas to the physical screen
-	Common::List<Common::Rect>::iterator i;
-	for (i = _dirtyRects.begin(); i != _dirtyRects.end(); ++i) {
+	// Loop through copying dirty areas to the physical screen. The dirty
+	// region never has overlapping rects, so no pixel is copied twice
+	_stats._rects = 0;
+	_stats._pixels = 0;
+	for (Common::Region::const_iterator i = _dirtyRegion.begin(); i != _dirtyRegion.end(); ++i) {
 		const Common::Rect &r = *i;
 		const byte *srcP = (const byte *)getBasePtr(r.left, r.top);
 		g_system->copyRectToScreen(srcP, pitch, r.left, r.top,
 			r.width(), r.height());
+
+		++_stats._rects;
+		_stats._pixels += r.width() * r.height();
 	}
 
+	++_stats._frames;
+	_stats._totalPixels += _stats._pixels;
+	if (_stats._pixels >= (uint32)(w * h))
+		++_stats._fullFrames;
+
 	// Signal the physical screen to update
 	g_system->updateScreen();
-	_dirtyRects.clear();
+	_dirtyRegion.clear();
 }
 
 
@@ -64,40 +71,19 @@ void Screen::addDirtyRect(const Common::Rect &r) {
 	bounds.translate(getOffsetFromOwner().x, getOffsetFromOwner().y);
 
 	if (bounds.width() > 0 && bounds.height() > 0)
-		_dirtyRects.push_back(bounds);
-}
-
-void Screen::makeAllDirty() {
-	addDirtyRect(Common::Rect(0, 0, this->w, this->h));
+		_dirtyRegion.addRect(bounds);
 }
 
-void Screen::mergeDirtyRects() {
-	Common::List<Common::Rect>::iterator rOuter, rInner;
-
-	// Process the dirty rect list to find any rects to merge
-	for (rOuter = _dirtyRects.begin(); rOuter != _dirtyRects.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != _dirtyRects.end()) {
-
-			if ((*rOuter).intersects(*rInner)) {
-				// These two rectangles overlap, so merge them
-				unionRectangle(*rOuter, *rOuter, *rInner);
-
-				// remove the inner rect from the list
-				_dirtyRects.erase(rInner);
+void Screen::addDirtyRegion(const Common::Region &region) {
+	Common::Region bounds = region;
+	bounds.clip(getBounds());
+	bounds.translate(getOffsetFromOwner().x, getOffsetFromOwner().y);
 
-				// move back to beginning of list
-				rInner = rOuter;
-			}
-		}
-	}
+	_dirtyRegion.unite(bounds);
 }
 
-bool Screen::unionRectangle(Common::Rect &destRect, const Common::Rect &src1, const Common::Rect &src2) {
-	destRect = src1;
-	destRect.extend(src2);
-
-	return !destRect.isEmpty();
+void Screen::makeAllDirty() {
+	addDirtyRect(Common::Rect(0, 0, this->w, this->h));
 }
 
 void Screen::getPalette(byte palette[PALETTE_SIZE]) {
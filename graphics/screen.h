@@ -27,6 +27,7 @@
 #include "graphics/pixelformat.h"
 #include "common/list.h"
 #include "common/rect.h"
+#include "common/region.h"
 
 namespace Graphics {
 
@@ -40,21 +41,26 @@ namespace Graphics {
  * areas to the physical screen
  */
 class Screen : public ManagedSurface {
-private:
+public:
 	/**
-	 * List of affected areas of the screen
+	 * Statistics about the screen updates
 	 */
-	Common::List<Common::Rect> _dirtyRects;
+	struct UpdateStats {
+		uint32 _frames;         ///< Number of calls to update so far
+		uint32 _rects;          ///< Rectangles copied by the last update
+		uint32 _pixels;         ///< Pixels copied by the last update
+		uint32 _totalPixels;    ///< Pixels copied by all updates so far
+		uint32 _fullFrames;     ///< Number of updates which copied the whole screen
+
+		UpdateStats() : _frames(0), _rects(0), _pixels(0), _totalPixels(0), _fullFrames(0) {}
+	};
 private:
 	/**
-	* Merges together overlapping dirty areas of the screen
-	*/
-	void mergeDirtyRects();
+	 * Affected areas of the screen
+	 */
+	Common::Region _dirtyRegion;
 
-	/**
-	* Returns the union of two dirty area rectangles
-	*/
-	bool unionRectangle(Common::Rect &destRect, const Common::Rect &src1, const Common::Rect &src2);
+	UpdateStats _stats;
 protected:
 	/**
 	 * Adds a rectangle to the list of modified areas of the screen during the
@@ -69,7 +75,7 @@ public:
 	/**
 	 * Returns true if there are any pending screen updates (dirty areas)
 	 */
-	bool isDirty() const { return !_dirtyRects.empty(); }
+	bool isDirty() const { return !_dirtyRegion.isEmpty(); }
 
 	/**
 	 * Marks the whole screen as dirty. This forces the next call to update
@@ -77,10 +83,28 @@ public:
 	 */
 	void makeAllDirty();
 
+	/**
+	 * Marks an area of the screen as dirty. This is meant for engines that
+	 * draw directly into the surface pixels, bypassing the drawing methods
+	 * which keep track of the affected areas on their own
+	 */
+	void addDirtyRegion(const Common::Region &region);
+
+	/**
+	 * Returns the areas of the screen which will be copied by the next update
+	 */
+	const Common::Region &getDirtyRegion() const { return _dirtyRegion; }
+
 	/**
 	 * Clear the current dirty rects list
 	 */
-	virtual void clearDirtyRects() { _dirtyRects.clear(); }
+	virtual void clearDirtyRects() { _dirtyRegion.clear(); }
+
+	/**
+	 * Returns statistics about how much of the screen has been copied to
+	 * the system by the calls to update
+	 */
+	const UpdateStats &getUpdateStats() const { return _stats; }
 
 	/**
 	 * Updates the screen by copying any affected areas to the system
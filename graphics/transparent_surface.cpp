@@ -57,6 +57,24 @@ static const int kGIndex = 1;
 static const int kRIndex = 0;
 #endif
 
+// Pixels loaded as a native uint32 are always RRGGBBAA, regardless of the
+// host endianness, so the channels can be processed two at a time.
+static const uint32 kAMask = 0x000000FF;
+static const uint32 kRBMask = 0xFF00FF00;
+
+/**
+ * Blends a single source pixel onto the target with the given source alpha.
+ * Red/blue and green/alpha are handled as pairs of 16-bit lanes, which gives
+ * exactly the same result as blending each channel on its own since
+ * x * a + y * (255 - a) never exceeds 16 bits.
+ */
+static inline uint32 blendPixelNormal(uint32 in, uint32 out, uint32 a) {
+	const uint32 ia = 255 - a;
+	const uint32 rb = ((in & kRBMask) >> 8) * a + ((out & kRBMask) >> 8) * ia;
+	const uint32 g = ((in >> 16) & 0xFF) * a + ((out >> 16) & 0xFF) * ia;
+	return (rb & kRBMask) | ((g << 8) & 0x00FF0000) | kAMask;
+}
+
 void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep);
 void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep);
 void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color);
@@ -92,10 +110,19 @@ void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		memcpy(out, in, width * 4);
-		for (uint32 j = 0; j < width; j++) {
-			out[kAIndex] = 0xFF;
-			out += 4;
+		if (inStep == 4) {
+			memcpy(out, in, width * 4);
+			for (uint32 j = 0; j < width; j++) {
+				out[kAIndex] = 0xFF;
+				out += 4;
+			}
+		} else {
+			// Horizontally flipped, so the source row has to be walked backwards
+			for (uint32 j = 0; j < width; j++) {
+				*(uint32 *)out = *(const uint32 *)in | kAMask;
+				out += 4;
+				in += inStep;
+			}
 		}
 		outo += pitch;
 		ino += inoStep;
@@ -115,11 +142,9 @@ void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		in = ino;
 		for (uint32 j = 0; j < width; j++) {
 			uint32 pix = *(uint32 *)in;
-			int a = in[kAIndex];
 
-			if (a != 0) {   // Full opacity (Any value not exactly 0 is Opaque here)
-				*(uint32 *)out = pix;
-				out[kAIndex] = 0xFF;
+			if (pix & kAMask) {   // Full opacity (Any value not exactly 0 is Opaque here)
+				*(uint32 *)out = pix | kAMask;
 			}
 			out += 4;
 			in += inStep;
@@ -149,17 +174,44 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
-
-				if (in[kAIndex] != 0) {
-					out[kAIndex] = 255;
-					out[kRIndex] = ((in[kRIndex] * in[kAIndex]) + out[kRIndex] * (255 - in[kAIndex])) >> 8;
-					out[kGIndex] = ((in[kGIndex] * in[kAIndex]) + out[kGIndex] * (255 - in[kAIndex])) >> 8;
-					out[kBIndex] = ((in[kBIndex] * in[kAIndex]) + out[kBIndex] * (255 - in[kAIndex])) >> 8;
+			uint32 j = 0;
+			while (j < width) {
+				uint32 pix = *(const uint32 *)in;
+				uint32 a = pix & kAMask;
+
+				if (a == 0) {
+					// Fully transparent span: leave the target untouched
+					do {
+						in += inStep;
+						out += 4;
+						j++;
+					} while (j < width && (*(const uint32 *)in & kAMask) == 0);
+				} else if (a == kAMask) {
+					// Fully opaque span: plain copy, no blending needed
+					uint32 run = 0;
+					const byte *runStart = in;
+					do {
+						in += inStep;
+						run++;
+					} while (j + run < width && (*(const uint32 *)in & kAMask) == kAMask);
+
+					if (inStep == 4) {
+						memcpy(out, runStart, run * 4);
+						out += run * 4;
+					} else {
+						for (uint32 k = 0; k < run; k++) {
+							*(uint32 *)out = *(const uint32 *)runStart;
+							runStart += inStep;
+							out += 4;
+						}
+					}
+					j += run;
+				} else {
+					*(uint32 *)out = blendPixelNormal(pix, *(const uint32 *)out, a);
+					in += inStep;
+					out += 4;
+					j++;
 				}
-
-				in += inStep;
-				out += 4;
 			}
 			outo += pitch;
 			ino += inoStep;
@@ -396,6 +448,29 @@ void doBlitMultiplyBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 
 }
 
+/**
+ * Picks the blending routine matching the blend mode, color modulation and
+ * alpha type of the source, once per blit rather than per pixel.
+ */
+static void doBlit(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color, TSpriteBlendMode blendMode, AlphaType alphaMode) {
+	if (color == 0xFFFFFFFF && blendMode == BLEND_NORMAL && alphaMode == ALPHA_OPAQUE) {
+		doBlitOpaqueFast(ino, outo, width, height, pitch, inStep, inoStep);
+	} else if (color == 0xFFFFFFFF && blendMode == BLEND_NORMAL && alphaMode == ALPHA_BINARY) {
+		doBlitBinaryFast(ino, outo, width, height, pitch, inStep, inoStep);
+	} else {
+		if (blendMode == BLEND_ADDITIVE) {
+			doBlitAdditiveBlend(ino, outo, width, height, pitch, inStep, inoStep, color);
+		} else if (blendMode == BLEND_SUBTRACTIVE) {
+			doBlitSubtractiveBlend(ino, outo, width, height, pitch, inStep, inoStep, color);
+		} else if (blendMode == BLEND_MULTIPLY) {
+			doBlitMultiplyBlend(ino, outo, width, height, pitch, inStep, inoStep, color);
+		} else {
+			assert(blendMode == BLEND_NORMAL);
+			doBlitAlphaBlend(ino, outo, width, height, pitch, inStep, inoStep, color);
+		}
+	}
+}
+
 Common::Rect TransparentSurface::blit(Graphics::Surface &target, int posX, int posY, int flipping, Common::Rect *pPartRect, uint color, int width, int height, TSpriteBlendMode blendMode) {
 
 	Common::Rect retSize;
@@ -513,22 +588,7 @@ Common::Rect TransparentSurface::blit(Graphics::Surface &target, int posX, int p
 		byte *ino = (byte *)img->getBasePtr(xp, yp);
 		byte *outo = (byte *)target.getBasePtr(posX, posY);
 
-		if (color == 0xFFFFFFFF && blendMode == BLEND_NORMAL && _alphaMode == ALPHA_OPAQUE) {
-			doBlitOpaqueFast(ino, outo, img->w, img->h, target.pitch, inStep, inoStep);
-		} else if (color == 0xFFFFFFFF && blendMode == BLEND_NORMAL && _alphaMode == ALPHA_BINARY) {
-			doBlitBinaryFast(ino, outo, img->w, img->h, target.pitch, inStep, inoStep);
-		} else {
-			if (blendMode == BLEND_ADDITIVE) {
-				doBlitAdditiveBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			} else if (blendMode == BLEND_SUBTRACTIVE) {
-				doBlitSubtractiveBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			} else if (blendMode == BLEND_MULTIPLY) {
-				doBlitMultiplyBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			} else {
-				assert(blendMode == BLEND_NORMAL);
-				doBlitAlphaBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			}
-		}
+		doBlit(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color, blendMode, _alphaMode);
 
 	}
 
@@ -660,22 +720,7 @@ Common::Rect TransparentSurface::blitClip(Graphics::Surface &target, Common::Rec
 		byte *ino = (byte *)img->getBasePtr(xp, yp);
 		byte *outo = (byte *)target.getBasePtr(posX, posY);
 
-		if (color == 0xFFFFFFFF && blendMode == BLEND_NORMAL && _alphaMode == ALPHA_OPAQUE) {
-			doBlitOpaqueFast(ino, outo, img->w, img->h, target.pitch, inStep, inoStep);
-		} else if (color == 0xFFFFFFFF && blendMode == BLEND_NORMAL && _alphaMode == ALPHA_BINARY) {
-			doBlitBinaryFast(ino, outo, img->w, img->h, target.pitch, inStep, inoStep);
-		} else {
-			if (blendMode == BLEND_ADDITIVE) {
-				doBlitAdditiveBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			} else if (blendMode == BLEND_SUBTRACTIVE) {
-				doBlitSubtractiveBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			} else if (blendMode == BLEND_MULTIPLY) {
-				doBlitMultiplyBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			} else {
-				assert(blendMode == BLEND_NORMAL);
-				doBlitAlphaBlend(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color);
-			}
-		}
+		doBlit(ino, outo, img->w, img->h, target.pitch, inStep, inoStep, color, blendMode, _alphaMode);
 
 	}
 
@@ -393,10 +393,20 @@ CinepakDecoder::~CinepakDecoder() {
 	delete[] _curFrame.strips;
 	delete[] _clipTableBuf;
 
-	delete[] _colorMap;
+	freeColorMap();
 	delete[] _ditherPalette;
 }
 
+void CinepakDecoder::freeColorMap() {
+	// The QuickTime dither table is shared with other codecs
+	if (_ditherType == kDitherTypeQT)
+		releaseQuickTimeDitherTable(_colorMap);
+	else
+		delete[] _colorMap;
+
+	_colorMap = 0;
+}
+
 const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream &stream) {
 	_curFrame.flags = stream.readByte();
 	_curFrame.length = (stream.readByte() << 16);
@@ -562,7 +572,7 @@ void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 co
 		const CinepakCodebook &codebook = _curFrame.strips[strip].v1_codebook[codebookIndex];
 		byte *output = _curFrame.strips[strip].v1_dither + (codebookIndex << 2);
 
-		byte *ditherEntry = _colorMap + createDitherTableIndex(_clipTable, codebook.y[0], codebook.u, codebook.v);
+		const byte *ditherEntry = _colorMap + createDitherTableIndex(_clipTable, codebook.y[0], codebook.u, codebook.v);
 		output[0x000] = ditherEntry[0x0000];
 		output[0x001] = ditherEntry[0x4000];
 		output[0x400] = ditherEntry[0xC000];
@@ -589,7 +599,7 @@ void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 co
 		const CinepakCodebook &codebook = _curFrame.strips[strip].v4_codebook[codebookIndex];
 		byte *output = _curFrame.strips[strip].v4_dither + (codebookIndex << 2);
 
-		byte *ditherEntry = _colorMap + createDitherTableIndex(_clipTable, codebook.y[0], codebook.u, codebook.v);
+		const byte *ditherEntry = _colorMap + createDitherTableIndex(_clipTable, codebook.y[0], codebook.u, codebook.v);
 		output[0x000] = ditherEntry[0x0000];
 		output[0x400] = ditherEntry[0x8000];
 		output[0x800] = ditherEntry[0x4000];
@@ -632,7 +642,7 @@ bool CinepakDecoder::canDither(DitherType type) const {
 void CinepakDecoder::setDither(DitherType type, const byte *palette) {
 	assert(canDither(type));
 
-	delete[] _colorMap;
+	freeColorMap();
 	delete[] _ditherPalette;
 
 	_ditherPalette = new byte[256 * 3];
@@ -643,14 +653,16 @@ void CinepakDecoder::setDither(DitherType type, const byte *palette) {
 	_ditherType = type;
 
 	if (type == kDitherTypeVFW) {
-		_colorMap = new byte[221];
+		byte *colorMap = new byte[221];
 
 		for (int i = 0; i < 221; i++)
-			_colorMap[i] = findNearestRGB(i);
+			colorMap[i] = findNearestRGB(i);
+
+		_colorMap = colorMap;
 	} else {
-		// Generate QuickTime dither table
+		// Get the QuickTime dither table
 		// 4 blocks of 0x4000 bytes (RGB554 lookup)
-		_colorMap = createQuickTimeDitherTable(palette, 256);
+		_colorMap = getQuickTimeDitherTable(palette, 256);
 	}
 }
 
@@ -91,9 +91,10 @@ private:
 
 	byte *_ditherPalette;
 	bool _dirtyPalette;
-	byte *_colorMap;
+	const byte *_colorMap;
 	DitherType _ditherType;
 
+	void freeColorMap();
 	void initializeCodebook(uint16 strip, byte codebookType);
 	void loadCodebook(Common::SeekableReadStream &stream, uint16 strip, byte codebookType, byte chunkID, uint32 chunkSize);
 	void decodeVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
@@ -20,7 +20,6 @@
  *
  */
 
-#include "common/list.h"
 #include "common/scummsys.h"
 
 #include "image/codecs/codec.h"
@@ -50,10 +49,29 @@ namespace Image {
 
 namespace {
 
+/**
+ * Queue of colors to check while building a QuickTime dither table.
+ *
+ * Every one of the 0x4000 RGB554 colors is queued at most once, so a fixed
+ * buffer is enough and saves allocating a list node for every color.
+ */
+struct DitherCheckQueue {
+	uint16 _colors[0x4000 + 2];
+	uint _head, _tail;
+
+	// Leave some space in front for the black/white special cases
+	DitherCheckQueue() : _head(2), _tail(2) {}
+
+	bool empty() const { return _head == _tail; }
+	void push_back(uint16 color) { assert(_tail < ARRAYSIZE(_colors)); _colors[_tail++] = color; }
+	void push_front(uint16 color) { assert(_head > 0); _colors[--_head] = color; }
+	uint16 pop_front() { return _colors[_head++]; }
+};
+
 /**
  * Add a color to the QuickTime dither table check queue if it hasn't already been found.
  */
-inline void addColorToQueue(uint16 color, uint16 index, byte *checkBuffer, Common::List<uint16> &checkQueue) {
+inline void addColorToQueue(uint16 color, uint16 index, byte *checkBuffer, DitherCheckQueue &checkQueue) {
 	if ((READ_UINT16(checkBuffer + color * 2) & 0xFF) == 0) {
 		// Previously unfound color
 		WRITE_UINT16(checkBuffer + color * 2, index);
@@ -76,7 +94,8 @@ byte *Codec::createQuickTimeDitherTable(const byte *palette, uint colorCount) {
 	byte *buf = new byte[0x10000];
 	memset(buf, 0, 0x10000);
 
-	Common::List<uint16> checkQueue;
+	DitherCheckQueue *checkQueuePtr = new DitherCheckQueue();
+	DitherCheckQueue &checkQueue = *checkQueuePtr;
 
 	bool foundBlack = false;
 	bool foundWhite = false;
@@ -120,8 +139,7 @@ byte *Codec::createQuickTimeDitherTable(const byte *palette, uint colorCount) {
 	// Go through the list of colors we have and match up similar colors
 	// to fill in the table as best as we can.
 	while (!checkQueue.empty()) {
-		uint16 col = checkQueue.front();
-		checkQueue.pop_front();
+		uint16 col = checkQueue.pop_front();
 		uint16 index = READ_UINT16(buf + col * 2);
 
 		uint32 x = col << 4;
@@ -143,6 +161,8 @@ byte *Codec::createQuickTimeDitherTable(const byte *palette, uint colorCount) {
 			addColorToQueue((z - 0x800) >> 2, index, buf, checkQueue);
 	}
 
+	delete checkQueuePtr;
+
 	// Contract the table back to just palette entries
 	for (int i = 0; i < 0x4000; i++)
 		buf[i] = READ_UINT16(buf + i * 2) >> 8;
@@ -195,6 +215,98 @@ byte *Codec::createQuickTimeDitherTable(const byte *palette, uint colorCount) {
 	return buf;
 }
 
+namespace {
+
+/**
+ * A QuickTime dither table shared between codecs.
+ */
+struct SharedDitherTable {
+	uint32 hash;
+	uint colorCount;
+	byte palette[256 * 3];
+	byte *table;
+	uint refCount;
+	uint32 lastUse;
+};
+
+// Enough for a couple of videos being open at the same time, plus a few
+// unused tables for the palettes most recently played with
+enum {
+	kSharedDitherTableCount = 6
+};
+
+SharedDitherTable s_sharedDitherTables[kSharedDitherTableCount];
+uint32 s_sharedDitherTableUse = 0;
+
+uint32 hashPalette(const byte *palette, uint colorCount) {
+	// FNV-1a
+	uint32 hash = 2166136261u;
+	for (uint i = 0; i < colorCount * 3; i++)
+		hash = (hash ^ palette[i]) * 16777619u;
+
+	return hash;
+}
+
+} // End of anonymous namespace
+
+const byte *Codec::getQuickTimeDitherTable(const byte *palette, uint colorCount) {
+	assert(colorCount <= 256);
+	uint32 hash = hashPalette(palette, colorCount);
+
+	for (uint i = 0; i < kSharedDitherTableCount; i++) {
+		SharedDitherTable &entry = s_sharedDitherTables[i];
+		if (entry.table && entry.hash == hash && entry.colorCount == colorCount && !memcmp(entry.palette, palette, colorCount * 3)) {
+			entry.refCount++;
+			entry.lastUse = ++s_sharedDitherTableUse;
+			return entry.table;
+		}
+	}
+
+	// Pick a free slot, or else the least recently used table no codec is using
+	SharedDitherTable *slot = 0;
+	for (uint i = 0; i < kSharedDitherTableCount; i++) {
+		SharedDitherTable &entry = s_sharedDitherTables[i];
+		if (!entry.table) {
+			slot = &entry;
+			break;
+		}
+
+		if (entry.refCount == 0 && (!slot || entry.lastUse < slot->lastUse))
+			slot = &entry;
+	}
+
+	byte *table = createQuickTimeDitherTable(palette, colorCount);
+
+	// If every table is in use, the new one is simply not shared
+	if (slot) {
+		delete[] slot->table;
+		slot->hash = hash;
+		slot->colorCount = colorCount;
+		memcpy(slot->palette, palette, colorCount * 3);
+		slot->table = table;
+		slot->refCount = 1;
+		slot->lastUse = ++s_sharedDitherTableUse;
+	}
+
+	return table;
+}
+
+void Codec::releaseQuickTimeDitherTable(const byte *table) {
+	if (!table)
+		return;
+
+	for (uint i = 0; i < kSharedDitherTableCount; i++) {
+		SharedDitherTable &entry = s_sharedDitherTables[i];
+		if (entry.table == table) {
+			assert(entry.refCount > 0);
+			entry.refCount--;
+			return;
+		}
+	}
+
+	delete[] table;
+}
+
 Codec *createBitmapCodec(uint32 tag, int width, int height, int bitsPerPixel) {
 	switch (tag) {
 	case SWAP_CONSTANT_32(0):
@@ -115,6 +115,23 @@ public:
 	 * Create a dither table, as used by QuickTime codecs.
 	 */
 	static byte *createQuickTimeDitherTable(const byte *palette, uint colorCount);
+
+	/**
+	 * Get a dither table, as used by QuickTime codecs.
+	 *
+	 * Unlike createQuickTimeDitherTable(), the table is shared by all codecs
+	 * dithering to the same palette, and kept around for a while after the
+	 * last codec is done with it, so that opening the next video with that
+	 * palette does not have to build it again.
+	 *
+	 * The table must be returned with releaseQuickTimeDitherTable().
+	 */
+	static const byte *getQuickTimeDitherTable(const byte *palette, uint colorCount);
+
+	/**
+	 * Release a table obtained from getQuickTimeDitherTable().
+	 */
+	static void releaseQuickTimeDitherTable(const byte *table);
 };
 
 /**
@@ -57,7 +57,7 @@ QTRLEDecoder::~QTRLEDecoder() {
 		delete _surface;
 	}
 
-	delete[] _colorMap;
+	releaseQuickTimeDitherTable(_colorMap);
 	delete[] _ditherPalette;
 }
 
@@ -527,8 +527,8 @@ void QTRLEDecoder::setDither(DitherType type, const byte *palette) {
 	memcpy(_ditherPalette, palette, 256 * 3);
 	_dirtyPalette = true;
 
-	delete[] _colorMap;
-	_colorMap = createQuickTimeDitherTable(palette, 256);
+	releaseQuickTimeDitherTable(_colorMap);
+	_colorMap = getQuickTimeDitherTable(palette, 256);
 }
 
 void QTRLEDecoder::createSurface() {
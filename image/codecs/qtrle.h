@@ -54,7 +54,7 @@ private:
 	uint32 _paddedWidth;
 	byte *_ditherPalette;
 	bool _dirtyPalette;
-	byte *_colorMap;
+	const byte *_colorMap;
 
 	void createSurface();
 
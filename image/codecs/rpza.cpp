@@ -50,7 +50,7 @@ RPZADecoder::~RPZADecoder() {
 	}
 
 	delete[] _ditherPalette;
-	delete[] _colorMap;
+	releaseQuickTimeDitherTable(_colorMap);
 }
 
 #define ADVANCE_BLOCK() \
@@ -360,8 +360,8 @@ void RPZADecoder::setDither(DitherType type, const byte *palette) {
 	_dirtyPalette = true;
 	_format = Graphics::PixelFormat::createFormatCLUT8();
 
-	delete[] _colorMap;
-	_colorMap = createQuickTimeDitherTable(palette, 256);
+	releaseQuickTimeDitherTable(_colorMap);
+	_colorMap = getQuickTimeDitherTable(palette, 256);
 }
 
 } // End of namespace Image
@@ -52,7 +52,7 @@ private:
 	Graphics::Surface *_surface;
 	byte *_ditherPalette;
 	bool _dirtyPalette;
-	byte *_colorMap;
+	const byte *_colorMap;
 	uint16 _width, _height;
 	uint16 _blockWidth, _blockHeight;
 };
@@ -0,0 +1,176 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// TransparentSurface blit benchmark. Blits synthetic sprites onto a 640x480
+// target with every alpha type and blend mode, and prints the time per
+// source pixel together with a checksum of the target, so that blitter
+// changes can be compared against previous builds.
+//
+// Build and run with "make blitbench".
+
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+#define FORBIDDEN_SYMBOL_EXCEPTION_clock
+#define FORBIDDEN_SYMBOL_EXCEPTION_printf
+#define FORBIDDEN_SYMBOL_EXCEPTION_stdout
+
+#include "common/scummsys.h"
+#include "common/util.h"
+#include "graphics/transparent_surface.h"
+
+#include <stdio.h>
+#include <time.h>
+
+namespace {
+
+enum {
+	kTargetWidth = 640,
+	kTargetHeight = 480,
+	kSpriteWidth = 200,
+	kSpriteHeight = 150
+};
+
+struct SpriteEntry {
+	const char *name;
+	Graphics::AlphaType alphaType;
+};
+
+const SpriteEntry sprites[] = {
+	{ "opaque", Graphics::ALPHA_OPAQUE },
+	{ "binary", Graphics::ALPHA_BINARY },
+	{ "full", Graphics::ALPHA_FULL }
+};
+
+struct BlendEntry {
+	const char *name;
+	Graphics::TSpriteBlendMode mode;
+	uint color;
+};
+
+const BlendEntry blends[] = {
+	{ "normal", Graphics::BLEND_NORMAL, (uint)TS_ARGB(255, 255, 255, 255) },
+	{ "normal-mod", Graphics::BLEND_NORMAL, (uint)TS_ARGB(160, 255, 128, 64) },
+	{ "additive", Graphics::BLEND_ADDITIVE, (uint)TS_ARGB(255, 255, 255, 255) },
+	{ "subtractive", Graphics::BLEND_SUBTRACTIVE, (uint)TS_ARGB(255, 255, 255, 255) },
+	{ "multiply", Graphics::BLEND_MULTIPLY, (uint)TS_ARGB(255, 255, 255, 255) }
+};
+
+uint32 randomState = 0x12345678;
+
+uint32 nextRandom() {
+	randomState = randomState * 1103515245 + 12345;
+	return randomState >> 16;
+}
+
+/**
+ * Fills a sprite the way typical game art looks: an opaque body inside a
+ * transparent border, with an antialiased edge for ALPHA_FULL.
+ */
+void fillSprite(Graphics::TransparentSurface &surf, Graphics::AlphaType alphaType) {
+	const Graphics::PixelFormat &format = surf.format;
+
+	for (int y = 0; y < surf.h; ++y) {
+		uint32 *row = (uint32 *)surf.getBasePtr(0, y);
+		for (int x = 0; x < surf.w; ++x) {
+			const int dx = x - surf.w / 2, dy = y - surf.h / 2;
+			const int dist = dx * dx * 9 / 16 + dy * dy - (surf.h / 2) * (surf.h / 2) * 3 / 4;
+			byte a;
+			if (alphaType == Graphics::ALPHA_OPAQUE)
+				a = 255;
+			else if (dist > 0)
+				a = 0;
+			else if (alphaType == Graphics::ALPHA_FULL && dist > -400)
+				a = -dist * 255 / 400;
+			else
+				a = 255;
+
+			row[x] = format.ARGBToColor(a, nextRandom() & 0xFF, (x * 255 / surf.w) & 0xFF, (y * 255 / surf.h) & 0xFF);
+		}
+	}
+
+	surf.setAlphaMode(alphaType);
+}
+
+void fillTarget(Graphics::Surface &surf) {
+	for (int y = 0; y < surf.h; ++y) {
+		uint32 *row = (uint32 *)surf.getBasePtr(0, y);
+		for (int x = 0; x < surf.w; ++x)
+			row[x] = surf.format.ARGBToColor(255, (x + y) & 0xFF, y & 0xFF, x & 0xFF);
+	}
+}
+
+uint32 checksum(const Graphics::Surface &surf) {
+	uint32 hash = 2166136261u;
+	for (int y = 0; y < surf.h; ++y) {
+		const byte *row = (const byte *)surf.getBasePtr(0, y);
+		for (int x = 0; x < surf.w * 4; ++x) {
+			hash ^= row[x];
+			hash *= 16777619u;
+		}
+	}
+	return hash;
+}
+
+void runSprite(const SpriteEntry &sprite, Graphics::Surface &target) {
+	Graphics::TransparentSurface surf;
+	surf.create(kSpriteWidth, kSpriteHeight, Graphics::TransparentSurface::getSupportedPixelFormat());
+	fillSprite(surf, sprite.alphaType);
+
+	for (uint i = 0; i < ARRAYSIZE(blends); ++i) {
+		const BlendEntry &blend = blends[i];
+
+		// Time the blits on a scratch target, then checksum a single blit
+		// onto a fresh one so the result doesn't depend on the iteration count
+		int iterations = 0;
+		const clock_t start = clock();
+		clock_t elapsed;
+		do {
+			surf.blit(target, (iterations * 37) % (kTargetWidth - kSpriteWidth),
+			          (iterations * 23) % (kTargetHeight - kSpriteHeight),
+			          Graphics::FLIP_NONE, nullptr, blend.color, -1, -1, blend.mode);
+			++iterations;
+			elapsed = clock() - start;
+		} while (elapsed < CLOCKS_PER_SEC / 2 || iterations < 10);
+
+		fillTarget(target);
+		surf.blit(target, 100, 100, Graphics::FLIP_NONE, nullptr, blend.color, -1, -1, blend.mode);
+
+		const double nsPerPixel = (double)elapsed * 1e9 / CLOCKS_PER_SEC / iterations / (kSpriteWidth * kSpriteHeight);
+		printf("%-8s %-12s %8.2f ns/pixel  %08x\n", sprite.name, blend.name, nsPerPixel, checksum(target));
+	}
+
+	surf.free();
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	Graphics::Surface target;
+	target.create(kTargetWidth, kTargetHeight, Graphics::TransparentSurface::getSupportedPixelFormat());
+
+	for (uint i = 0; i < ARRAYSIZE(sprites); ++i) {
+		fillTarget(target);
+		runSprite(sprites[i], target);
+	}
+
+	target.free();
+	return 0;
+}
@@ -0,0 +1,187 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// Scaler benchmark. Runs every scaler over synthetic 320x200 frames and
+// prints the time per source pixel together with a checksum of the output,
+// so that optimized scalers can be compared against previous builds.
+//
+// Build and run with "make scalerbench".
+
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+#define FORBIDDEN_SYMBOL_EXCEPTION_clock
+#define FORBIDDEN_SYMBOL_EXCEPTION_printf
+#define FORBIDDEN_SYMBOL_EXCEPTION_stdout
+
+#include "common/scummsys.h"
+#include "common/util.h"
+#include "graphics/colormasks.h"
+#include "graphics/scaler.h"
+#include "graphics/scaler/aspect.h"
+
+#include <stdio.h>
+#include <time.h>
+
+extern int gBitFormat;
+
+namespace {
+
+enum {
+	kWidth = 320,
+	kHeight = 200,
+	kBorder = 4,
+	kSrcPitch = (kWidth + 2 * kBorder) * 2,
+	kMaxScale = 3,
+	kDstPitch = kWidth * kMaxScale * 2,
+	kDstHeight = 240 * kMaxScale
+};
+
+struct ScalerEntry {
+	const char *name;
+	ScalerProc *proc;
+	int dstWidth;
+	int dstHeight;
+};
+
+const ScalerEntry scalers[] = {
+	{ "Normal1x", Normal1x, kWidth, kHeight },
+#ifdef USE_SCALERS
+	{ "Normal1xAspect", Normal1xAspect, kWidth, kHeight * 6 / 5 },
+	{ "Normal2x", Normal2x, kWidth * 2, kHeight * 2 },
+	{ "Normal3x", Normal3x, kWidth * 3, kHeight * 3 },
+	{ "Normal1o5x", Normal1o5x, kWidth * 3 / 2, kHeight * 3 / 2 },
+	{ "2xSaI", _2xSaI, kWidth * 2, kHeight * 2 },
+	{ "Super2xSaI", Super2xSaI, kWidth * 2, kHeight * 2 },
+	{ "SuperEagle", SuperEagle, kWidth * 2, kHeight * 2 },
+	{ "AdvMame2x", AdvMame2x, kWidth * 2, kHeight * 2 },
+	{ "AdvMame3x", AdvMame3x, kWidth * 3, kHeight * 3 },
+	{ "TV2x", TV2x, kWidth * 2, kHeight * 2 },
+	{ "DotMatrix", DotMatrix, kWidth * 2, kHeight * 2 },
+#ifdef USE_HQ_SCALERS
+	{ "HQ2x", HQ2x, kWidth * 2, kHeight * 2 },
+	{ "HQ3x", HQ3x, kWidth * 3, kHeight * 3 },
+#endif
+#endif
+};
+
+uint32 randomState = 0x12345678;
+
+uint32 nextRandom() {
+	randomState = randomState * 1103515245 + 12345;
+	return randomState >> 16;
+}
+
+/**
+ * Typical game content: a CLUT8 picture made of flat areas, outlines and
+ * dithering, expanded through a palette the same way the backends do before
+ * handing the frame to the scaler.
+ */
+void fillPaletted(uint16 *buf, const Graphics::PixelFormat &format) {
+	uint16 palette[256];
+	for (int i = 0; i < 256; ++i)
+		palette[i] = format.RGBToColor(nextRandom() & 0xFF, nextRandom() & 0xFF, nextRandom() & 0xFF);
+
+	byte clut[kHeight][kWidth];
+	for (int y = 0; y < kHeight; ++y)
+		for (int x = 0; x < kWidth; ++x)
+			clut[y][x] = (y < 120) ? 1 + y / 30 : 8 + ((x + y) & 1);
+
+	for (int i = 0; i < 60; ++i) {
+		const int x0 = nextRandom() % kWidth, y0 = nextRandom() % kHeight;
+		const int w = 4 + nextRandom() % 60, h = 4 + nextRandom() % 40;
+		const byte color = nextRandom() & 0xFF;
+		for (int y = y0; y < y0 + h && y < kHeight; ++y)
+			for (int x = x0; x < x0 + w && x < kWidth; ++x)
+				clut[y][x] = (y == y0 || x == x0) ? 0 : color;
+	}
+
+	for (int y = 0; y < kHeight + 2 * kBorder; ++y) {
+		for (int x = 0; x < kWidth + 2 * kBorder; ++x) {
+			const int sx = CLIP<int>(x - kBorder, 0, kWidth - 1);
+			const int sy = CLIP<int>(y - kBorder, 0, kHeight - 1);
+			buf[y * (kSrcPitch / 2) + x] = palette[clut[sy][sx]];
+		}
+	}
+}
+
+/**
+ * Hi-color content: smooth gradients with some noise.
+ */
+void fillHiColor(uint16 *buf, const Graphics::PixelFormat &format) {
+	for (int y = 0; y < kHeight + 2 * kBorder; ++y) {
+		for (int x = 0; x < kWidth + 2 * kBorder; ++x) {
+			const int n = nextRandom() & 0x0F;
+			buf[y * (kSrcPitch / 2) + x] = format.RGBToColor((x * 255 / kWidth + n) & 0xFF, (y * 255 / kHeight) & 0xFF, ((x + y) / 2 + n) & 0xFF);
+		}
+	}
+}
+
+uint32 checksum(const byte *buf, uint32 pitch, int width, int height) {
+	uint32 hash = 2166136261u;
+	for (int y = 0; y < height; ++y, buf += pitch) {
+		for (int x = 0; x < width; ++x) {
+			hash ^= buf[x];
+			hash *= 16777619u;
+		}
+	}
+	return hash;
+}
+
+void runFrame(const char *frameName, const uint16 *src) {
+	static byte dst[kDstPitch * kDstHeight];
+	const byte *srcPtr = (const byte *)(src + kBorder * (kSrcPitch / 2) + kBorder);
+
+	for (uint i = 0; i < ARRAYSIZE(scalers); ++i) {
+		const ScalerEntry &entry = scalers[i];
+		const uint32 dstPitch = entry.dstWidth * 2;
+
+		int iterations = 0;
+		const clock_t start = clock();
+		clock_t elapsed;
+		do {
+			entry.proc(srcPtr, kSrcPitch, dst, dstPitch, kWidth, kHeight);
+			++iterations;
+			elapsed = clock() - start;
+		} while (elapsed < CLOCKS_PER_SEC / 2 || iterations < 10);
+
+		const double nsPerPixel = (double)elapsed * 1e9 / CLOCKS_PER_SEC / iterations / (kWidth * kHeight);
+		printf("%-8s %-16s %8.2f ns/pixel  %08x\n", frameName, entry.name, nsPerPixel,
+		       checksum(dst, dstPitch, entry.dstWidth * 2, entry.dstHeight));
+	}
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	static uint16 src[(kSrcPitch / 2) * (kHeight + 2 * kBorder)];
+	const Graphics::PixelFormat format = Graphics::createPixelFormat<565>();
+
+	InitScalers(565);
+
+	fillPaletted(src, format);
+	runFrame("clut8", src);
+
+	fillHiColor(src, format);
+	runFrame("16bpp", src);
+
+	DestroyScalers();
+	return 0;
+}
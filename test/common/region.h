@@ -0,0 +1,167 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/region.h"
+
+class RegionTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_empty() {
+		Common::Region r;
+		TS_ASSERT(r.isEmpty());
+		TS_ASSERT_EQUALS(r.getArea(), (uint32)0);
+
+		r.addRect(Common::Rect(5, 5, 5, 10));
+		TS_ASSERT(r.isEmpty());
+	}
+
+	void test_single_rect() {
+		Common::Region r(Common::Rect(10, 20, 30, 40));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)1);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(10, 20, 30, 40));
+		TS_ASSERT_EQUALS(r.getArea(), (uint32)400);
+		TS_ASSERT_EQUALS(r.getBounds(), Common::Rect(10, 20, 30, 40));
+	}
+
+	void test_overlap_is_counted_once() {
+		Common::Region r;
+		r.addRect(Common::Rect(0, 0, 10, 10));
+		r.addRect(Common::Rect(5, 5, 15, 15));
+
+		// Two overlapping 10x10 squares share a 5x5 area
+		TS_ASSERT_EQUALS(r.getArea(), (uint32)175);
+		TS_ASSERT_EQUALS(r.getBounds(), Common::Rect(0, 0, 15, 15));
+
+		// Three bands: top part of the first square, the overlap, the bottom part of the second
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)3);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(0, 0, 10, 5));
+		TS_ASSERT_EQUALS(r.getRects()[1], Common::Rect(0, 5, 15, 10));
+		TS_ASSERT_EQUALS(r.getRects()[2], Common::Rect(5, 10, 15, 15));
+	}
+
+	void test_coalescing() {
+		Common::Region r;
+		// Horizontally touching rects are joined
+		r.addRect(Common::Rect(0, 0, 10, 10));
+		r.addRect(Common::Rect(10, 0, 20, 10));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)1);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(0, 0, 20, 10));
+
+		// Vertically touching bands with the same spans are joined
+		r.addRect(Common::Rect(0, 10, 20, 30));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)1);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(0, 0, 20, 30));
+
+		// Contained rects don't change anything
+		r.addRect(Common::Rect(2, 2, 8, 8));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)1);
+		TS_ASSERT_EQUALS(r.getArea(), (uint32)600);
+	}
+
+	void test_disjoint() {
+		Common::Region r;
+		r.addRect(Common::Rect(50, 0, 60, 10));
+		r.addRect(Common::Rect(0, 0, 10, 10));
+		r.addRect(Common::Rect(0, 100, 10, 110));
+
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)3);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(0, 0, 10, 10));
+		TS_ASSERT_EQUALS(r.getRects()[1], Common::Rect(50, 0, 60, 10));
+		TS_ASSERT_EQUALS(r.getRects()[2], Common::Rect(0, 100, 10, 110));
+		TS_ASSERT_EQUALS(r.getArea(), (uint32)300);
+	}
+
+	void test_band_insertion() {
+		Common::Region r;
+		r.addRect(Common::Rect(0, 20, 10, 30));
+		r.addRect(Common::Rect(0, 0, 10, 10));
+		r.addRect(Common::Rect(20, 40, 30, 50));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)3);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(0, 0, 10, 10));
+		TS_ASSERT_EQUALS(r.getRects()[1], Common::Rect(0, 20, 10, 30));
+		TS_ASSERT_EQUALS(r.getRects()[2], Common::Rect(20, 40, 30, 50));
+
+		// Filling the gap joins the bands above and below
+		r.addRect(Common::Rect(0, 10, 10, 20));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)2);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(0, 0, 10, 30));
+		TS_ASSERT_EQUALS(r.getRects()[1], Common::Rect(20, 40, 30, 50));
+
+		// A band with a different span stays separate
+		r.addRect(Common::Rect(0, 30, 20, 40));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)3);
+		TS_ASSERT_EQUALS(r.getRects()[1], Common::Rect(0, 30, 20, 40));
+	}
+
+	void test_add_matches_unite() {
+		Common::Region r1, r2;
+		uint32 seed = 1;
+
+		for (int i = 0; i < 200; ++i) {
+			seed = seed * 1103515245 + 12345;
+			const int16 x = (seed >> 8) % 100, y = (seed >> 16) % 100;
+			seed = seed * 1103515245 + 12345;
+			const Common::Rect rect(x, y, x + 1 + (seed >> 8) % 20, y + 1 + (seed >> 16) % 20);
+
+			r1.addRect(rect);
+			r2.unite(Common::Region(rect));
+			TS_ASSERT_EQUALS(r1, r2);
+		}
+	}
+
+	void test_order_independence() {
+		Common::Region r1, r2;
+		Common::Rect rects[] = {
+			Common::Rect(0, 0, 100, 20),
+			Common::Rect(30, 10, 60, 80),
+			Common::Rect(90, 50, 120, 60),
+			Common::Rect(10, 70, 40, 75)
+		};
+
+		for (int i = 0; i < 4; ++i) {
+			r1.addRect(rects[i]);
+			r2.addRect(rects[3 - i]);
+		}
+
+		TS_ASSERT_EQUALS(r1, r2);
+	}
+
+	void test_clip() {
+		Common::Region r;
+		r.addRect(Common::Rect(0, 0, 10, 10));
+		r.addRect(Common::Rect(20, 0, 30, 10));
+		r.clip(Common::Rect(5, 5, 25, 20));
+
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)2);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(5, 5, 10, 10));
+		TS_ASSERT_EQUALS(r.getRects()[1], Common::Rect(20, 5, 25, 10));
+
+		r.clip(Common::Rect(0, 0, 8, 8));
+		TS_ASSERT_EQUALS(r.getRects().size(), (uint)1);
+		TS_ASSERT_EQUALS(r.getRects()[0], Common::Rect(5, 5, 8, 8));
+
+		r.clip(Common::Rect(100, 100, 200, 200));
+		TS_ASSERT(r.isEmpty());
+	}
+
+	void test_contains_intersects() {
+		Common::Region r;
+		r.addRect(Common::Rect(0, 0, 10, 10));
+		r.addRect(Common::Rect(10, 5, 20, 10));
+
+		TS_ASSERT(r.contains(Common::Rect(0, 5, 20, 10)));
+		TS_ASSERT(!r.contains(Common::Rect(0, 0, 20, 10)));
+		TS_ASSERT(r.intersects(Common::Rect(15, 0, 25, 6)));
+		TS_ASSERT(!r.intersects(Common::Rect(15, 0, 25, 5)));
+	}
+
+	void test_unite_regions() {
+		Common::Region r1(Common::Rect(0, 0, 10, 10));
+		Common::Region r2(Common::Rect(0, 10, 10, 20));
+		r1.unite(r2);
+		TS_ASSERT_EQUALS(r1.getRects().size(), (uint)1);
+		TS_ASSERT_EQUALS(r1.getRects()[0], Common::Rect(0, 0, 10, 20));
+
+		r1.translate(5, -5);
+		TS_ASSERT_EQUALS(r1.getRects()[0], Common::Rect(5, -5, 15, 15));
+	}
+};
@@ -0,0 +1,81 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/scaler.h"
+
+/**
+ * Regression checks for the pixel art scalers. The expected checksums were
+ * taken from the straightforward implementations the scalers had before they
+ * were optimized, so any change to their output shows up here.
+ */
+class ScalerTestSuite : public CxxTest::TestSuite {
+	public:
+	enum {
+		kWidth = 37,
+		kHeight = 23,
+		kBorder = 2,
+		kSrcPitch = (kWidth + 2 * kBorder) * 2
+	};
+
+	uint16 _src[(kWidth + 2 * kBorder) * (kHeight + 2 * kBorder)];
+
+	void setUp() {
+		InitScalers(565);
+
+		// Flat areas, dithering and noise, as found in game graphics
+		uint32 seed = 0x2468ACE1;
+		for (int y = 0; y < kHeight + 2 * kBorder; y++) {
+			for (int x = 0; x < kWidth + 2 * kBorder; x++) {
+				seed = seed * 1103515245 + 12345;
+				uint16 color;
+				if (x < 12)
+					color = (y < 10) ? 0x1234 : 0xF800;
+				else if (x < 24)
+					color = ((x + y) & 1) ? 0x07E0 : 0x0821;
+				else
+					color = (uint16)(seed >> 16) & ((y & 4) ? 0xFFFF : 0x18E3);
+				_src[y * (kSrcPitch / 2) + x] = color;
+			}
+		}
+	}
+
+	void tearDown() {
+		DestroyScalers();
+	}
+
+	uint32 scaleAndHash(ScalerProc *proc, int factor, int width, int height) {
+		const uint32 dstPitch = kWidth * factor * 2;
+		byte *dst = new byte[dstPitch * kHeight * factor];
+		memset(dst, 0, dstPitch * kHeight * factor);
+
+		const byte *srcPtr = (const byte *)(_src + kBorder * (kSrcPitch / 2) + kBorder);
+		proc(srcPtr, kSrcPitch, dst, dstPitch, width, height);
+
+		uint32 hash = 2166136261u;
+		for (uint32 i = 0; i < dstPitch * kHeight * factor; i++) {
+			hash ^= dst[i];
+			hash *= 16777619u;
+		}
+		delete[] dst;
+		return hash;
+	}
+
+#ifdef USE_SCALERS
+	void test_advmame() {
+		TS_ASSERT_EQUALS(scaleAndHash(AdvMame2x, 2, kWidth, kHeight), 855141702u);
+		TS_ASSERT_EQUALS(scaleAndHash(AdvMame3x, 3, kWidth, kHeight), 2150613477u);
+	}
+
+#ifdef USE_HQ_SCALERS
+	void test_hq() {
+		TS_ASSERT_EQUALS(scaleAndHash(HQ2x, 2, kWidth, kHeight), 3065479319u);
+		TS_ASSERT_EQUALS(scaleAndHash(HQ3x, 3, kWidth, kHeight), 4291298870u);
+	}
+
+	void test_hq_narrow() {
+		// Single pixel wide and high updates, as dirty rects may be
+		TS_ASSERT_EQUALS(scaleAndHash(HQ2x, 2, 1, kHeight), 316304197u);
+		TS_ASSERT_EQUALS(scaleAndHash(HQ3x, 3, kWidth, 1), 1794982254u);
+	}
+#endif
+#endif
+};
@@ -0,0 +1,162 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/transparent_surface.h"
+
+/**
+ * Checks the span based blitting paths of TransparentSurface against a
+ * straightforward per-channel implementation of the same blending rules.
+ */
+class TransparentSurfaceTestSuite : public CxxTest::TestSuite {
+	public:
+	static uint32 makePixel(byte a, byte r, byte g, byte b) {
+		return ((uint32)r << 24) | ((uint32)g << 16) | ((uint32)b << 8) | a;
+	}
+
+	static uint32 referenceBlend(uint32 in, uint32 out) {
+		uint32 a = in & 0xFF;
+		if (a == 0)
+			return out;
+		if (a == 255)
+			return in;
+
+		uint32 result = 0xFF;
+		for (int shift = 8; shift < 32; shift += 8) {
+			uint32 ic = (in >> shift) & 0xFF;
+			uint32 oc = (out >> shift) & 0xFF;
+			result |= (((ic * a) + oc * (255 - a)) >> 8) << shift;
+		}
+		return result;
+	}
+
+	void fillSource(Graphics::TransparentSurface &src) {
+		// Rows mix transparent, opaque and translucent spans of varying length
+		static const byte alphas[] = { 0, 0, 0, 255, 255, 128, 1, 254, 255, 0, 64, 255, 255, 255, 0, 200, 0 };
+		for (int y = 0; y < src.h; y++) {
+			for (int x = 0; x < src.w; x++) {
+				byte a = alphas[(x + y * 3) % ARRAYSIZE(alphas)];
+				*(uint32 *)src.getBasePtr(x, y) = makePixel(a, (byte)(x * 7 + y), (byte)(x * 13), (byte)(y * 29 + x));
+			}
+		}
+	}
+
+	void fillTarget(Graphics::Surface &dst) {
+		for (int y = 0; y < dst.h; y++) {
+			for (int x = 0; x < dst.w; x++) {
+				*(uint32 *)dst.getBasePtr(x, y) = makePixel(0xFF, (byte)(y * 11), (byte)(x * 5 + y), (byte)(x * 3));
+			}
+		}
+	}
+
+	void test_blit_alpha_blend() {
+		Graphics::TransparentSurface src;
+		src.create(37, 11, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillSource(src);
+
+		Graphics::Surface dst;
+		dst.create(64, 32, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillTarget(dst);
+
+		Graphics::Surface expected;
+		expected.copyFrom(dst);
+		for (int y = 0; y < src.h; y++) {
+			for (int x = 0; x < src.w; x++) {
+				uint32 *out = (uint32 *)expected.getBasePtr(x + 5, y + 3);
+				*out = referenceBlend(*(const uint32 *)src.getBasePtr(x, y), *out);
+			}
+		}
+
+		src.blit(dst, 5, 3);
+
+		for (int y = 0; y < dst.h; y++) {
+			for (int x = 0; x < dst.w; x++) {
+				TS_ASSERT_EQUALS(*(const uint32 *)dst.getBasePtr(x, y), *(const uint32 *)expected.getBasePtr(x, y));
+			}
+		}
+
+		src.free();
+		dst.free();
+		expected.free();
+	}
+
+	void test_blit_alpha_blend_flipped() {
+		Graphics::TransparentSurface src;
+		src.create(23, 9, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillSource(src);
+
+		Graphics::Surface dst;
+		dst.create(23, 9, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillTarget(dst);
+
+		Graphics::Surface expected;
+		expected.copyFrom(dst);
+		for (int y = 0; y < src.h; y++) {
+			for (int x = 0; x < src.w; x++) {
+				uint32 *out = (uint32 *)expected.getBasePtr(src.w - 1 - x, y);
+				*out = referenceBlend(*(const uint32 *)src.getBasePtr(x, y), *out);
+			}
+		}
+
+		src.blit(dst, 0, 0, Graphics::FLIP_H);
+
+		for (int y = 0; y < dst.h; y++) {
+			for (int x = 0; x < dst.w; x++) {
+				TS_ASSERT_EQUALS(*(const uint32 *)dst.getBasePtr(x, y), *(const uint32 *)expected.getBasePtr(x, y));
+			}
+		}
+
+		src.free();
+		dst.free();
+		expected.free();
+	}
+
+	void test_blit_opaque_flipped() {
+		Graphics::TransparentSurface src;
+		src.create(16, 4, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillSource(src);
+		src.setAlphaMode(Graphics::ALPHA_OPAQUE);
+
+		Graphics::Surface dst;
+		dst.create(16, 4, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillTarget(dst);
+
+		src.blit(dst, 0, 0, Graphics::FLIP_H);
+
+		for (int y = 0; y < dst.h; y++) {
+			for (int x = 0; x < dst.w; x++) {
+				uint32 in = *(const uint32 *)src.getBasePtr(src.w - 1 - x, y);
+				TS_ASSERT_EQUALS(*(const uint32 *)dst.getBasePtr(x, y), in | 0xFF);
+			}
+		}
+
+		src.free();
+		dst.free();
+	}
+
+	void test_blit_binary() {
+		Graphics::TransparentSurface src;
+		src.create(19, 5, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillSource(src);
+		src.setAlphaMode(Graphics::ALPHA_BINARY);
+
+		Graphics::Surface dst;
+		dst.create(19, 5, Graphics::TransparentSurface::getSupportedPixelFormat());
+		fillTarget(dst);
+
+		Graphics::Surface orig;
+		orig.copyFrom(dst);
+
+		src.blit(dst);
+
+		for (int y = 0; y < dst.h; y++) {
+			for (int x = 0; x < dst.w; x++) {
+				uint32 in = *(const uint32 *)src.getBasePtr(x, y);
+				uint32 expected = (in & 0xFF) ? (in | 0xFF) : *(const uint32 *)orig.getBasePtr(x, y);
+				TS_ASSERT_EQUALS(*(const uint32 *)dst.getBasePtr(x, y), expected);
+			}
+		}
+
+		src.free();
+		dst.free();
+		orig.free();
+	}
+};
@@ -5,8 +5,8 @@
 #
 ######################################################################
 
-TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h
-TEST_LIBS    := audio/libaudio.a common/libcommon.a
+TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/graphics/*.h
+TEST_LIBS    := audio/libaudio.a graphics/libgraphics.a common/libcommon.a
 
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
@@ -42,8 +42,20 @@ test/runner.cpp: $(TESTS)
 	@mkdir -p test
 	$(srcdir)/test/cxxtest/cxxtestgen.py $(TEST_FLAGS) -o $@ $+
 
+# Scaler benchmark, see test/benchmark/scalers.cpp.
+scalerbench: test/scalerbench
+	./test/scalerbench
+test/scalerbench: $(srcdir)/test/benchmark/scalers.cpp graphics/libgraphics.a common/libcommon.a
+	$(QUIET_CXX)$(CXX) $(TEST_CXXFLAGS) $(CPPFLAGS) -o $@ $+ $(TEST_LDFLAGS)
+
+# TransparentSurface blit benchmark, see test/benchmark/blit.cpp.
+blitbench: test/blitbench
+	./test/blitbench
+test/blitbench: $(srcdir)/test/benchmark/blit.cpp graphics/libgraphics.a common/libcommon.a
+	$(QUIET_CXX)$(CXX) $(TEST_CXXFLAGS) $(CPPFLAGS) -o $@ $+ $(TEST_LDFLAGS)
+
 clean: clean-test
 clean-test:
-	-$(RM) test/runner.cpp test/runner
+	-$(RM) test/runner.cpp test/runner test/scalerbench test/blitbench
 
-.PHONY: test clean-test
+.PHONY: test scalerbench blitbench clean-test
@@ -339,7 +339,7 @@ QuickTimeDecoder::VideoTrackHandler::~VideoTrackHandler() {
 	}
 
 	delete[] _forcedDitherPalette;
-	delete[] _ditherTable;
+	Image::Codec::releaseQuickTimeDitherTable(_ditherTable);
 
 	if (_ditherFrame) {
 		_ditherFrame->free();
@@ -843,7 +843,8 @@ void QuickTimeDecoder::VideoTrackHandler::setDither(const byte *palette) {
 			// Forced dither
 			_forcedDitherPalette = new byte[256 * 3];
 			memcpy(_forcedDitherPalette, palette, 256 * 3);
-			_ditherTable = Image::Codec::createQuickTimeDitherTable(_forcedDitherPalette, 256);
+			Image::Codec::releaseQuickTimeDitherTable(_ditherTable);
+			_ditherTable = Image::Codec::getQuickTimeDitherTable(_forcedDitherPalette, 256);
 			_dirtyPalette = true;
 		}
 	}
@@ -160,7 +160,7 @@ private:
 
 		// Forced dithering of frames
 		byte *_forcedDitherPalette;
-		byte *_ditherTable;
+		const byte *_ditherTable;
 		Graphics::Surface *_ditherFrame;
 		const Graphics::Surface *forceDither(const Graphics::Surface &frame);
 